@@ -62,6 +62,14 @@ cd abuild
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\settings.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\project.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\dependency.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\fingerprint.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\file_view_windows.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\file_view.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\file_status.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\file_status_windows.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\directory_watcher_windows.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\directory_watcher.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\arena.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\file.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\header.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\source.cpp"
@@ -69,41 +77,79 @@ cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\m
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\error.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\warning.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\build_task.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\string_interner.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\suffix_trie.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\build_cache_index.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\override.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\toolchain.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\binary_stream.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\thread_pool.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\trace.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\artifact_store.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\build_cache.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\project_scanner.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\token.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\character_search.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\tokenizer.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\code_scanner.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\dependency_scanner.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\incremental_scanner.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\cache_watcher.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\build_graph.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\compact_build_graph.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\build_report.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\build_scheduler.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\toolchain_scanner.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\command_builder.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\build_executor.cpp"
+cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /internalPartition "%PROJECTS_ROOT%\abuild\header_unit_prebuilder.cpp"
 cl.exe %CPP_FLAGS_OPTIMIZED% /c /Fo /interface /TP "%PROJECTS_ROOT%\abuild\abuild.cpp"
 lib.exe /NOLOGO ^
         /OUT:abuild.lib ^
         code_scanner.obj ^
         dependency_scanner.obj ^
+        incremental_scanner.obj ^
+        cache_watcher.obj ^
         token.obj ^
+        character_search.obj ^
         tokenizer.obj ^
         dependency.obj ^
         settings.obj ^
         project.obj ^
+        file_view_windows.obj ^
+        file_view.obj ^
+        file_status.obj ^
+        file_status_windows.obj ^
+        directory_watcher_windows.obj ^
+        directory_watcher.obj ^
+        arena.obj ^
         file.obj ^
         header.obj ^
         source.obj ^
         module.obj ^
         error.obj ^
         warning.obj ^
+        string_interner.obj ^
+        suffix_trie.obj ^
         build_cache_index.obj ^
+        binary_stream.obj ^
         build_cache.obj ^
         project_scanner.obj ^
         build_task.obj ^
         build_graph.obj ^
+        compact_build_graph.obj ^
+        build_report.obj ^
+        build_scheduler.obj ^
         override.obj ^
         toolchain.obj ^
         toolchain_scanner.obj ^
+        thread_pool.obj ^
+        trace.obj ^
+        fingerprint.obj ^
+        artifact_store.obj ^
+        command_builder.obj ^
+        build_executor.obj ^
+        header_unit_prebuilder.obj ^
         abuild.obj
 cl.exe %CPP_FLAGS_OPTIMIZED% ^
        /Fe"%BUILD_ROOT%\bin\abuild.exe" ^
@@ -199,12 +245,16 @@ lib.exe /NOLOGO ^
 cl.exe %CPP_FLAGS_OPTIMIZED% ^
        /Fe"%BUILD_ROOT%\bin\abuild_test.exe" ^
        "%PROJECTS_ROOT%\abuild\test\main.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\arena_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\file_test.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\file_view_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\code_scanner_headers_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\code_scanner_modules_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\code_scanner_sources_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\dependency_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\dependency_scanner_test.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\incremental_scanner_test.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\cache_watcher_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\header_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\source_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\module_test.cpp" ^
@@ -217,10 +267,20 @@ cl.exe %CPP_FLAGS_OPTIMIZED% ^
        "%PROJECTS_ROOT%\abuild\test\build_cache_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\build_task_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\build_graph_test.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\compact_build_graph_test.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\build_report_test.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\build_scheduler_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\toolchain_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\toolchain_scanner_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\override_test.cpp" ^
        "%PROJECTS_ROOT%\abuild\test\override_settings_test.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\thread_pool_test.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\trace_test.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\fingerprint_test.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\artifact_store_test.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\command_builder_test.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\build_executor_test.cpp" ^
+       "%PROJECTS_ROOT%\abuild\test\header_unit_prebuilder_test.cpp" ^
        "%BUILD_ROOT%\astl\astl.obj" ^
        "%BUILD_ROOT%\atest\atest.lib" ^
        "%BUILD_ROOT%\acore\acore.lib" ^
@@ -229,4 +289,22 @@ cl.exe %CPP_FLAGS_OPTIMIZED% ^
        "%BUILD_ROOT%\abuild_test\abuild_test_utilities.lib"
 cd ..
 
+REM abuild_benchmark
+mkdir abuild_benchmark
+cd abuild_benchmark
+cl.exe %CPP_FLAGS_OPTIMIZED% ^
+       /Fe"%BUILD_ROOT%\bin\abuild_benchmark.exe" ^
+       "%PROJECTS_ROOT%\abuild\benchmark\main.cpp" ^
+       "%PROJECTS_ROOT%\abuild\benchmark\tokenizer_benchmark.cpp" ^
+       "%PROJECTS_ROOT%\abuild\benchmark\build_cache_benchmark.cpp" ^
+       "%PROJECTS_ROOT%\abuild\benchmark\build_cache_index_benchmark.cpp" ^
+       "%PROJECTS_ROOT%\abuild\benchmark\build_graph_benchmark.cpp" ^
+       "%PROJECTS_ROOT%\abuild\benchmark\build_executor_benchmark.cpp" ^
+       "%BUILD_ROOT%\astl\astl.obj" ^
+       "%BUILD_ROOT%\atest\atest.lib" ^
+       "%BUILD_ROOT%\acore\acore.lib" ^
+       "%BUILD_ROOT%\abuild\abuild.lib" ^
+       "%BUILD_ROOT%\rapidjson\rapidjson.obj"
+cd ..
+
 cd ..
@@ -23,6 +23,7 @@ CPP_FLAGS="-std=c++20 \
            -fmodules \
            -fimplicit-module-maps \
            -fmodule-map-file="$PROJECTS_ROOT/acore/module.modulemap" \
+           -fmodule-map-file="$PROJECTS_ROOT/abuild/module.modulemap" \
            -fprebuilt-module-path=$BUILD_ROOT/acore \
            -fprebuilt-module-path=$BUILD_ROOT/atest \
            -fprebuilt-module-path=$BUILD_ROOT/abuild \
@@ -106,8 +107,12 @@ cd abuild_test
          "$PROJECTS_ROOT/abuild/test/tokenizer_test.cpp" \
          "$PROJECTS_ROOT/abuild/test/dependency_test.cpp" \
          "$PROJECTS_ROOT/abuild/test/dependency_scanner_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/incremental_scanner_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/cache_watcher_test.cpp" \
          "$PROJECTS_ROOT/abuild/test/module_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/arena_test.cpp" \
          "$PROJECTS_ROOT/abuild/test/file_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/file_view_test.cpp" \
          "$PROJECTS_ROOT/abuild/test/code_scanner_headers_test.cpp" \
          "$PROJECTS_ROOT/abuild/test/code_scanner_modules_test.cpp" \
          "$PROJECTS_ROOT/abuild/test/code_scanner_sources_test.cpp" \
@@ -121,10 +126,20 @@ cd abuild_test
          "$PROJECTS_ROOT/abuild/test/build_cache_test.cpp" \
          "$PROJECTS_ROOT/abuild/test/build_task_test.cpp" \
          "$PROJECTS_ROOT/abuild/test/build_graph_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/compact_build_graph_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/build_report_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/build_scheduler_test.cpp" \
          "$PROJECTS_ROOT/abuild/test/toolchain_test.cpp" \
          "$PROJECTS_ROOT/abuild/test/toolchain_scanner_test.cpp" \
          "$PROJECTS_ROOT/abuild/test/override_test.cpp" \
          "$PROJECTS_ROOT/abuild/test/override_settings_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/thread_pool_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/trace_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/fingerprint_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/artifact_store_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/command_builder_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/build_executor_test.cpp" \
+         "$PROJECTS_ROOT/abuild/test/header_unit_prebuilder_test.cpp" \
          "$BUILD_ROOT/acore/acore.obj" \
          "$BUILD_ROOT/abuild/abuild.obj" \
          "$BUILD_ROOT/atest/atest.obj" \
@@ -132,4 +147,20 @@ cd abuild_test
          -o "$BUILD_ROOT/bin/abuild_test"
 cd ..
 
+#abuild_benchmark
+mkdir -p abuild_benchmark
+cd abuild_benchmark
+"$CLANG" $CPP_AND_LINK_FLAGS \
+         "$PROJECTS_ROOT/abuild/benchmark/main.cpp" \
+         "$PROJECTS_ROOT/abuild/benchmark/tokenizer_benchmark.cpp" \
+         "$PROJECTS_ROOT/abuild/benchmark/build_cache_benchmark.cpp" \
+         "$PROJECTS_ROOT/abuild/benchmark/build_cache_index_benchmark.cpp" \
+         "$PROJECTS_ROOT/abuild/benchmark/build_graph_benchmark.cpp" \
+         "$PROJECTS_ROOT/abuild/benchmark/build_executor_benchmark.cpp" \
+         "$BUILD_ROOT/acore/acore.obj" \
+         "$BUILD_ROOT/abuild/abuild.obj" \
+         "$BUILD_ROOT/atest/atest.obj" \
+         -o "$BUILD_ROOT/bin/abuild_benchmark"
+cd ..
+
 cd ..
@@ -2,18 +2,38 @@ export module abuild;
 
 #ifdef _MSC_VER
 export import : build_cache;
+export import : file_view;
 export import : project_scanner;
+export import : thread_pool;
+export import : fingerprint;
+export import : artifact_store;
 export import : code_scanner;
 export import : dependency_scanner;
+export import : incremental_scanner;
+export import : cache_watcher;
 export import : build_graph;
+export import : compact_build_graph;
+export import : build_report;
+export import : build_scheduler;
 export import : toolchain_scanner;
+export import : build_executor;
+export import : header_unit_prebuilder;
 #else
 // clang-format off
 export import <astl.hpp>;
 import<rapidjson.hpp>;
+import acore;
 #include "settings.cpp"
 #include "project.cpp"
 #include "dependency.cpp"
+#include "fingerprint.cpp"
+#include "file_view_unix.cpp"
+#include "file_view.cpp"
+#include "file_status.cpp"
+#include "file_status_unix.cpp"
+#include "directory_watcher_unix.cpp"
+#include "directory_watcher.cpp"
+#include "arena.cpp"
 #include "file.cpp"
 #include "header.cpp"
 #include "source.cpp"
@@ -21,16 +41,31 @@ import<rapidjson.hpp>;
 #include "error.cpp"
 #include "warning.cpp"
 #include "build_task.cpp"
+#include "string_interner.cpp"
+#include "suffix_trie.cpp"
 #include "build_cache_index.cpp"
 #include "toolchain.cpp"
 #include "override.cpp"
+#include "binary_stream.cpp"
+#include "thread_pool.cpp"
+#include "trace.cpp"
+#include "artifact_store.cpp"
 #include "build_cache.cpp"
 #include "project_scanner.cpp"
 #include "token.cpp"
+#include "character_search.cpp"
 #include "tokenizer.cpp"
 #include "code_scanner.cpp"
 #include "dependency_scanner.cpp"
+#include "incremental_scanner.cpp"
+#include "cache_watcher.cpp"
 #include "build_graph.cpp"
+#include "compact_build_graph.cpp"
+#include "build_report.cpp"
+#include "build_scheduler.cpp"
 #include "toolchain_scanner.cpp"
+#include "command_builder.cpp"
+#include "build_executor.cpp"
+#include "header_unit_prebuilder.cpp"
 // clang-format on
 #endif
@@ -0,0 +1,233 @@
+#ifdef _MSC_VER
+export module abuild : arena;
+export import<astl.hpp>;
+#endif
+
+namespace abuild
+{
+export struct AllocationStatistics
+{
+    std::size_t allocations = 0;
+    std::size_t bytes = 0;
+    std::size_t blockAllocations = 0;
+    std::size_t blockBytes = 0;
+    std::size_t heapAllocations = 0;
+    std::size_t heapBytes = 0;
+};
+
+class AllocationCounter : public std::pmr::memory_resource
+{
+public:
+    explicit AllocationCounter(std::pmr::memory_resource *upstream) :
+        mUpstream{upstream}
+    {
+    }
+
+    [[nodiscard]] auto allocations() const noexcept -> std::size_t
+    {
+        return mAllocations;
+    }
+
+    [[nodiscard]] auto bytes() const noexcept -> std::size_t
+    {
+        return mBytes;
+    }
+
+private:
+    auto do_allocate(std::size_t bytes, std::size_t alignment) -> void * override
+    {
+        ++mAllocations;
+        mBytes += bytes;
+        return mUpstream->allocate(bytes, alignment);
+    }
+
+    auto do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) -> void override
+    {
+        mUpstream->deallocate(pointer, bytes, alignment);
+    }
+
+    [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource &other) const noexcept -> bool override
+    {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource *mUpstream = nullptr;
+    std::atomic<std::size_t> mAllocations = 0;
+    std::atomic<std::size_t> mBytes = 0;
+};
+
+export template<typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) noexcept :
+        mResource{resource}
+    {
+    }
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept :
+        mResource{other.resource()}
+    {
+    }
+
+    [[nodiscard]] auto allocate(std::size_t count) -> T *
+    {
+        return static_cast<T *>(mResource->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    auto deallocate(T *pointer, std::size_t count) -> void
+    {
+        mResource->deallocate(pointer, count * sizeof(T), alignof(T));
+    }
+
+    [[nodiscard]] auto resource() const noexcept -> std::pmr::memory_resource *
+    {
+        return mResource;
+    }
+
+    [[nodiscard]] auto select_on_container_copy_construction() const noexcept -> ArenaAllocator
+    {
+        return ArenaAllocator{};
+    }
+
+    template<typename U>
+    [[nodiscard]] auto operator==(const ArenaAllocator<U> &other) const noexcept -> bool
+    {
+        return mResource == other.resource() || mResource->is_equal(*other.resource());
+    }
+
+private:
+    std::pmr::memory_resource *mResource = nullptr;
+};
+
+export template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+export template<typename T, typename Hash = std::hash<T>>
+using ArenaSet = std::unordered_set<T, Hash, std::equal_to<T>, ArenaAllocator<T>>;
+
+export class Arena
+{
+public:
+    enum class Mode
+    {
+        Pooled,
+        Heap
+    };
+
+    Arena() :
+        Arena{Mode::Pooled}
+    {
+    }
+
+    explicit Arena(Mode mode) :
+        mState{std::make_unique<State>(mode)}
+    {
+    }
+
+    Arena(const Arena &other) = delete;
+    Arena(Arena &&other) noexcept = default;
+
+    ~Arena()
+    {
+        destroy();
+    }
+
+    auto clear() -> void
+    {
+        const Mode mode = mState->mode;
+        destroy();
+        mState = std::make_unique<State>(mode);
+    }
+
+    template<typename T, typename... Args>
+    [[nodiscard]] auto create(Args &&...args) -> T *
+    {
+        void *memory = mState->objectResource()->allocate(sizeof(T), alignof(T));
+        T *object = new (memory) T(std::forward<Args>(args)...);
+        ++mState->objects;
+        mState->objectBytes += sizeof(T);
+
+        if (!std::is_trivially_destructible_v<T> || mState->mode == Mode::Heap)
+        {
+            mState->destructors.push_back({object, [](void *value, std::pmr::memory_resource *resource) {
+                                               static_cast<T *>(value)->~T();
+                                               resource->deallocate(value, sizeof(T), alignof(T));
+                                           }});
+        }
+
+        return object;
+    }
+
+    [[nodiscard]] auto resource() const noexcept -> std::pmr::memory_resource *
+    {
+        return &mState->requests;
+    }
+
+    [[nodiscard]] auto statistics() const noexcept -> AllocationStatistics
+    {
+        return AllocationStatistics{.allocations = mState->objects + mState->requests.allocations(),
+                                    .bytes = mState->objectBytes + mState->requests.bytes(),
+                                    .blockAllocations = mState->blocks.allocations(),
+                                    .blockBytes = mState->blocks.bytes()};
+    }
+
+    auto operator=(const Arena &other) -> Arena & = delete;
+
+    auto operator=(Arena &&other) noexcept -> Arena &
+    {
+        if (this != &other)
+        {
+            destroy();
+            mState = std::move(other.mState);
+        }
+
+        return *this;
+    }
+
+private:
+    struct State
+    {
+        explicit State(Mode mode) :
+            mode{mode},
+            requests{mode == Mode::Pooled ? static_cast<std::pmr::memory_resource *>(&pool.emplace(&buffer.emplace(&blocks))) : &blocks}
+        {
+        }
+
+        [[nodiscard]] auto objectResource() noexcept -> std::pmr::memory_resource *
+        {
+            return buffer ? static_cast<std::pmr::memory_resource *>(&*buffer) : &blocks;
+        }
+
+        Mode mode = Mode::Pooled;
+        AllocationCounter blocks{std::pmr::get_default_resource()};
+        std::optional<std::pmr::monotonic_buffer_resource> buffer;
+        std::optional<std::pmr::synchronized_pool_resource> pool;
+        AllocationCounter requests;
+        std::vector<std::pair<void *, void (*)(void *, std::pmr::memory_resource *)>> destructors;
+        std::size_t objects = 0;
+        std::size_t objectBytes = 0;
+    };
+
+    auto destroy() noexcept -> void
+    {
+        if (mState)
+        {
+            for (auto it = mState->destructors.rbegin(); it != mState->destructors.rend(); ++it)
+            {
+                it->second(it->first, mState->objectResource());
+            }
+
+            mState->destructors.clear();
+        }
+    }
+
+    std::unique_ptr<State> mState;
+};
+}
@@ -0,0 +1,193 @@
+#ifdef _MSC_VER
+export module abuild : artifact_store;
+export import<astl.hpp>;
+#endif
+
+namespace abuild
+{
+export class ArtifactStore
+{
+public:
+    ArtifactStore(std::filesystem::path root, std::uintmax_t sizeLimit) :
+        mRoot{std::move(root)},
+        mSizeLimit{sizeLimit}
+    {
+    }
+
+    [[nodiscard]] auto fetch(const std::string &key, const std::vector<std::filesystem::path> &outputs) const -> bool
+    {
+        const std::filesystem::path entry = entryPath(key);
+        std::error_code error;
+
+        for (std::size_t i = 0; i < outputs.size(); ++i)
+        {
+            if (!std::filesystem::is_regular_file(entry / std::to_string(i), error))
+            {
+                return false;
+            }
+        }
+
+        for (std::size_t i = 0; i < outputs.size(); ++i)
+        {
+            std::filesystem::create_directories(outputs[i].parent_path(), error);
+
+            if (!std::filesystem::copy_file(entry / std::to_string(i), outputs[i], std::filesystem::copy_options::overwrite_existing, error))
+            {
+                return false;
+            }
+        }
+
+        std::filesystem::last_write_time(entry, std::filesystem::file_time_type::clock::now(), error);
+        return true;
+    }
+
+    [[nodiscard]] auto root() const noexcept -> const std::filesystem::path &
+    {
+        return mRoot;
+    }
+
+    [[nodiscard]] auto size() -> std::uintmax_t
+    {
+        std::scoped_lock lock{mMutex};
+        return currentSize();
+    }
+
+    auto store(const std::string &key, const std::vector<std::filesystem::path> &outputs) -> bool
+    {
+        const std::filesystem::path entry = entryPath(key);
+        const std::filesystem::path staging = mRoot / STAGING_DIRECTORY / (key + '.' + uniqueSuffix());
+        std::error_code error;
+
+        if (std::filesystem::exists(entry, error))
+        {
+            return true;
+        }
+
+        std::filesystem::create_directories(staging, error);
+        bool stored = !error;
+        std::uintmax_t size = 0;
+
+        for (std::size_t i = 0; stored && i < outputs.size(); ++i)
+        {
+            stored = std::filesystem::copy_file(outputs[i], staging / std::to_string(i), error);
+            size += stored ? std::filesystem::file_size(staging / std::to_string(i), error) : 0;
+        }
+
+        if (stored)
+        {
+            std::filesystem::create_directories(entry.parent_path(), error);
+            std::filesystem::rename(staging, entry, error);
+            stored = !error || std::filesystem::exists(entry, error);
+        }
+
+        std::filesystem::remove_all(staging, error);
+
+        if (stored)
+        {
+            std::scoped_lock lock{mMutex};
+            const std::uintmax_t total = mSize ? (*mSize += size) : currentSize();
+
+            if (total > mSizeLimit)
+            {
+                evict(mSizeLimit - mSizeLimit / EVICTION_HEADROOM);
+            }
+        }
+
+        return stored;
+    }
+
+private:
+    struct Entry
+    {
+        std::filesystem::path path;
+        std::filesystem::file_time_type lastUse;
+        std::uintmax_t size = 0;
+    };
+
+    [[nodiscard]] auto currentSize() -> std::uintmax_t
+    {
+        if (!mSize)
+        {
+            mSize = 0;
+
+            for (const Entry &entry : entries())
+            {
+                *mSize += entry.size;
+            }
+        }
+
+        return *mSize;
+    }
+
+    [[nodiscard]] auto entries() const -> std::vector<Entry>
+    {
+        std::vector<Entry> result;
+        std::error_code error;
+
+        for (std::filesystem::directory_iterator bucket{mRoot, error}; bucket != std::filesystem::directory_iterator{}; bucket.increment(error))
+        {
+            if (!bucket->is_directory(error) || bucket->path().filename() == STAGING_DIRECTORY)
+            {
+                continue;
+            }
+
+            for (std::filesystem::directory_iterator entry{bucket->path(), error}; entry != std::filesystem::directory_iterator{}; entry.increment(error))
+            {
+                Entry &stored = result.emplace_back(Entry{.path = entry->path(), .lastUse = entry->last_write_time(error)});
+
+                for (std::filesystem::directory_iterator file{entry->path(), error}; file != std::filesystem::directory_iterator{}; file.increment(error))
+                {
+                    stored.size += file->file_size(error);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    [[nodiscard]] auto entryPath(const std::string &key) const -> std::filesystem::path
+    {
+        return mRoot / key.substr(0, 2) / key;
+    }
+
+    auto evict(std::uintmax_t targetSize) -> void
+    {
+        std::vector<Entry> stored = entries();
+        std::sort(stored.begin(), stored.end(), [](const Entry &left, const Entry &right) { return left.lastUse < right.lastUse; });
+        std::uintmax_t size = 0;
+        std::error_code error;
+
+        for (const Entry &entry : stored)
+        {
+            size += entry.size;
+        }
+
+        for (const Entry &entry : stored)
+        {
+            if (size <= targetSize)
+            {
+                break;
+            }
+
+            std::filesystem::remove_all(entry.path, error);
+            size -= entry.size;
+        }
+
+        mSize = size;
+    }
+
+    [[nodiscard]] static auto uniqueSuffix() -> std::string
+    {
+        static std::atomic<std::uint64_t> counter = 0;
+        return std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + '.' + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + '.' + std::to_string(++counter);
+    }
+
+    static constexpr const char *STAGING_DIRECTORY = "staging";
+    static constexpr std::uintmax_t EVICTION_HEADROOM = 10;
+
+    std::filesystem::path mRoot;
+    std::uintmax_t mSizeLimit = 0;
+    std::mutex mMutex;
+    std::optional<std::uintmax_t> mSize;
+};
+}
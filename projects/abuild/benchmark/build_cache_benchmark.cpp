@@ -0,0 +1,97 @@
+import abuild;
+import atest;
+
+using atest::expect;
+using atest::suite;
+using atest::test;
+
+[[nodiscard]] auto generateProject(const std::filesystem::path &root, std::size_t projects, std::size_t files) -> std::filesystem::path
+{
+    std::filesystem::remove_all(root);
+
+    for (std::size_t p = 0; p < projects; ++p)
+    {
+        const std::filesystem::path directory = root / "projects" / ("project" + std::to_string(p));
+        std::filesystem::create_directories(directory);
+
+        for (std::size_t f = 0; f < files; ++f)
+        {
+            const std::string name = "file" + std::to_string(f);
+            std::ofstream{directory / (name + ".hpp")} << "#pragma once\n#include <vector>\n#include \"file" << (f + 1) % files << ".hpp\"\n";
+            std::ofstream{directory / (name + ".cpp")} << "#include \"" << name << ".hpp\"\n#include <string>\nauto foo" << f << "() -> int { return " << f << "; }\n";
+        }
+    }
+
+    return std::filesystem::canonical(root);
+}
+
+template<typename Function>
+[[nodiscard]] auto measure(const char *label, Function &&function) -> std::size_t
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << "    " << label << ": " << elapsed / 1000 << '.' << std::setw(3) << std::setfill('0') << elapsed % 1000 << std::setfill(' ') << " ms\n";
+
+    return static_cast<std::size_t>(elapsed);
+}
+
+static const auto testSuite = suite("abuild::BuildCache (benchmark)", [] {
+    test("snapshot of 20 projects with 500 sources and 500 headers each", [] {
+        const std::filesystem::path root = generateProject("abuild_build_cache_benchmark", 20, 500);
+        const std::filesystem::path snapshot = root / "build" / "abuild.cache";
+
+        std::size_t sources = 0;
+        abuild::AllocationStatistics statistics;
+        abuild::AllocationStatistics baseline;
+
+        const std::size_t scan = measure("full scan", [&] {
+            abuild::BuildCache cache{root};
+            abuild::ProjectScanner{cache};
+            abuild::CodeScanner{cache};
+            abuild::DependencyScanner{cache};
+            cache.save(snapshot);
+            sources = cache.sources().size();
+        });
+
+        const std::size_t load = measure("snapshot load", [&] {
+            abuild::BuildCache cache{root};
+            expect(cache.load(snapshot)).toBe(true);
+            expect(cache.sources().size()).toBe(sources);
+            statistics = cache.allocationStatistics();
+        });
+
+        measure("snapshot load without arena", [&] {
+            abuild::BuildCache cache{root, abuild::Arena::Mode::Heap};
+            expect(cache.load(snapshot)).toBe(true);
+            baseline = cache.allocationStatistics();
+        });
+
+        for (const char *name : {"project0/file0.cpp", "project7/file250.hpp", "project19/file499.cpp"})
+        {
+            const std::filesystem::path path = root / "projects" / name;
+            const std::filesystem::file_time_type timestamp = std::filesystem::last_write_time(path);
+            std::ofstream{path, std::ios::app} << "#include <map>\n";
+            std::filesystem::last_write_time(path, timestamp + std::chrono::hours{1});
+        }
+
+        const std::size_t incremental = measure("snapshot load + incremental rescan of 3 files", [&] {
+            abuild::BuildCache cache{root};
+            expect(cache.load(snapshot)).toBe(true);
+            const abuild::IncrementalScanner scanner{cache};
+            expect(scanner.rescannedSources().size() + scanner.rescannedHeaders().size()).toBe(std::size_t{3});
+        });
+
+        std::cout << "    snapshot size: " << std::filesystem::file_size(snapshot) / 1024 << " KB, speedup " << scan / std::max<std::size_t>(load, 1) << "x (load), "
+                  << scan / std::max<std::size_t>(incremental, 1) << "x (incremental)\n";
+
+        std::cout << "    snapshot load allocations: " << statistics.allocations << " (" << statistics.bytes / 1024 << " KB) served from "
+                  << statistics.blockAllocations << " blocks (" << statistics.blockBytes / 1024 << " KB), "
+                  << baseline.blockAllocations << " heap allocations (" << baseline.blockBytes / 1024 << " KB) without arena\n";
+        std::cout << "    dependency names left on the heap: " << statistics.heapAllocations << " (" << statistics.heapBytes / 1024 << " KB)\n";
+
+        std::filesystem::remove_all(root);
+    });
+});
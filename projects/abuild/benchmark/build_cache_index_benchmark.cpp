@@ -0,0 +1,81 @@
+import abuild;
+import atest;
+
+using atest::expect;
+using atest::suite;
+using atest::test;
+
+[[nodiscard]] auto generateHeaders(const std::filesystem::path &root, std::size_t libraries, std::size_t modules) -> std::filesystem::path
+{
+    std::filesystem::remove_all(root);
+
+    for (std::size_t l = 0; l < libraries; ++l)
+    {
+        for (std::size_t m = 0; m < modules; ++m)
+        {
+            const std::filesystem::path directory = root / ("library" + std::to_string(l)) / ("module" + std::to_string(m)) / "include";
+            std::filesystem::create_directories(directory);
+            std::ofstream{directory / "types.hpp"};
+            std::ofstream{directory / "types.cpp"};
+        }
+    }
+
+    return std::filesystem::canonical(root);
+}
+
+template<typename Function>
+auto measureLookups(const char *label, std::size_t lookups, Function &&function) -> void
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << "    " << label << ": " << elapsed / 1000 << '.' << std::setw(3) << std::setfill('0') << elapsed % 1000 << std::setfill(' ') << " ms ("
+              << elapsed * 1000 / static_cast<std::int64_t>(lookups) << " ns per lookup)\n";
+}
+
+static const auto testSuite = suite("abuild::BuildCacheIndex (benchmark)", [] {
+    test("50 libraries with 1000 modules each with the same header name", [] {
+        constexpr std::size_t libraries = 50;
+        constexpr std::size_t modules = 1000;
+        const std::filesystem::path root = generateHeaders("abuild_build_cache_index_benchmark", libraries, modules);
+
+        abuild::BuildCache cache{root};
+        std::vector<abuild::Header *> headers;
+        std::vector<abuild::Source *> includers;
+        std::vector<std::string> includes;
+
+        for (std::size_t l = 0; l < libraries; ++l)
+        {
+            for (std::size_t m = 0; m < modules; ++m)
+            {
+                const std::string library = "library" + std::to_string(l);
+                const std::string include = library + "/module" + std::to_string(m) + "/include/";
+                headers.push_back(cache.addHeader(root / (include + "types.hpp"), library));
+                includers.push_back(cache.addSource(root / (include + "types.cpp"), library));
+                includes.push_back(include + "types.hpp");
+            }
+        }
+
+        std::size_t found = 0;
+
+        measureLookups("suffix lookup 'libraryN/moduleM/include/types.hpp'", headers.size(), [&] {
+            for (std::size_t i = 0; i < headers.size(); ++i)
+            {
+                found += cache.header(includes[i]) == headers[i] ? 1 : 0;
+            }
+        });
+
+        measureLookups("includer relative lookup 'types.hpp'", headers.size(), [&] {
+            for (std::size_t i = 0; i < headers.size(); ++i)
+            {
+                found += cache.header("types.hpp", includers[i]) == headers[i] ? 1 : 0;
+            }
+        });
+
+        expect(found).toBe(headers.size() * 2);
+
+        std::filesystem::remove_all(root);
+    });
+});
@@ -0,0 +1,74 @@
+import abuild;
+import atest;
+
+using atest::expect;
+using atest::suite;
+using atest::test;
+
+#ifndef _WIN32
+[[nodiscard]] auto generateTranslationUnits(const std::filesystem::path &root, std::size_t projects, std::size_t files) -> std::filesystem::path
+{
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "tools");
+    std::ofstream{root / ".abuild"} << "{ \"settings\": { \"storeDirectory\": \"\", \"ignoreDirectories\": [ \"build\", \"tools\" ] } }";
+    std::ofstream{root / "tools" / "compiler.sh"} << "#!/bin/sh\nwhile [ $# -gt 0 ]; do\n  if [ \"$1\" = \"-o\" ] || [ \"$1\" = \"rcs\" ]; then : > \"$2\"; fi\n  shift\ndone\n";
+    std::filesystem::permissions(root / "tools" / "compiler.sh", std::filesystem::perms::owner_all);
+
+    for (std::size_t p = 0; p < projects; ++p)
+    {
+        const std::filesystem::path directory = root / "projects" / ("project" + std::to_string(p));
+        std::filesystem::create_directories(directory);
+        std::ofstream{directory / "common.hpp"} << "#pragma once\n#include <vector>\n";
+
+        for (std::size_t f = 0; f < files; ++f)
+        {
+            const std::string name = "file" + std::to_string(f);
+            std::ofstream{directory / (name + ".hpp")} << "#pragma once\n#include \"common.hpp\"\n";
+            std::ofstream{directory / (name + ".cpp")} << "#include \"" << name << ".hpp\"\nauto foo" << f << "() -> int { return " << f << "; }\n";
+        }
+    }
+
+    return std::filesystem::canonical(root);
+}
+
+template<typename Function>
+auto measureBuild(const char *label, Function &&function) -> void
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << "    " << label << ": " << elapsed / 1000 << '.' << std::setw(3) << std::setfill('0') << elapsed % 1000 << std::setfill(' ') << " ms\n";
+}
+
+static const auto testSuite = suite("abuild::BuildExecutor (benchmark)", [] {
+    test("no-op build of 20 projects with 1000 sources each", [] {
+        const std::filesystem::path root = generateTranslationUnits("abuild_build_executor_benchmark", 20, 1000);
+        const abuild::Toolchain toolchain{
+            .name = "benchmark",
+            .type = abuild::Toolchain::Type::Clang,
+            .compiler = root / "tools" / "compiler.sh",
+            .linker = root / "tools" / "compiler.sh",
+            .archiver = root / "tools" / "compiler.sh"};
+
+        abuild::BuildCache cache{root};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        measureBuild("full build", [&] {
+            const abuild::BuildExecutor executor{cache, toolchain};
+            expect(executor.failedTasks()).toBe(0u);
+        });
+
+        measureBuild("no-op build", [&] {
+            const abuild::BuildExecutor executor{cache, toolchain};
+            expect(executor.upToDateTasks()).toBe(cache.buildTasks().size());
+        });
+
+        std::filesystem::remove_all(root);
+    });
+});
+#endif
@@ -0,0 +1,173 @@
+import abuild;
+import atest;
+
+using atest::expect;
+using atest::suite;
+using atest::test;
+
+[[nodiscard]] auto generateLibraries(const std::filesystem::path &root, std::size_t libraries, std::size_t headers, std::size_t sources) -> std::filesystem::path
+{
+    std::filesystem::remove_all(root);
+
+    for (std::size_t l = 0; l < libraries; ++l)
+    {
+        const std::filesystem::path directory = root / ("library" + std::to_string(l));
+        std::filesystem::create_directories(directory);
+
+        for (std::size_t h = 0; h < headers; ++h)
+        {
+            std::ofstream{directory / ("header" + std::to_string(h) + ".hpp")};
+        }
+
+        for (std::size_t s = 0; s < sources; ++s)
+        {
+            std::ofstream{directory / ("source" + std::to_string(s) + ".cpp")};
+        }
+    }
+
+    return std::filesystem::canonical(root);
+}
+
+template<typename Function>
+auto measureElapsed(const char *label, Function &&function) -> void
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << "    " << label << ": " << elapsed / 1000 << '.' << std::setw(3) << std::setfill('0') << elapsed % 1000 << std::setfill(' ') << " ms\n";
+}
+
+static const auto testSuite = suite("abuild::BuildGraph (benchmark)", [] {
+    test("10000 headers in a DAG included by 1000 sources", [] {
+        constexpr std::size_t libraries = 100;
+        constexpr std::size_t headersPerLibrary = 100;
+        constexpr std::size_t sourcesPerLibrary = 10;
+        constexpr std::size_t includesPerFile = 8;
+        const std::filesystem::path root = generateLibraries("abuild_build_graph_benchmark", libraries, headersPerLibrary, sourcesPerLibrary);
+
+        abuild::BuildCache cache{root};
+        std::vector<abuild::Header *> headers;
+        std::vector<std::string> includes;
+
+        for (std::size_t l = 0; l < libraries; ++l)
+        {
+            for (std::size_t h = 0; h < headersPerLibrary; ++h)
+            {
+                const std::string library = "library" + std::to_string(l);
+                const std::string include = library + "/header" + std::to_string(h) + ".hpp";
+                headers.push_back(cache.addHeader(root / include, library));
+                includes.push_back(include);
+            }
+        }
+
+        std::mt19937 generator{42};
+
+        auto addIncludes = [&](abuild::File *file, std::size_t count) {
+            for (std::size_t i = 0; i < includesPerFile && count != 0; ++i)
+            {
+                const std::size_t index = std::uniform_int_distribution<std::size_t>{0, count - 1}(generator);
+                file->addDependency(abuild::IncludeExternalHeaderDependency{.name = includes[index], .header = headers[index]});
+            }
+        };
+
+        for (std::size_t i = 0; i < headers.size(); ++i)
+        {
+            addIncludes(headers[i], i);
+        }
+
+        for (std::size_t l = 0; l < libraries; ++l)
+        {
+            for (std::size_t s = 0; s < sourcesPerLibrary; ++s)
+            {
+                const std::string library = "library" + std::to_string(l);
+                addIncludes(cache.addSource(root / library / ("source" + std::to_string(s) + ".cpp"), library), headers.size());
+            }
+        }
+
+        measureElapsed("build graph", [&] { abuild::BuildGraph{cache}; });
+
+        std::size_t edges = 0;
+
+        measureElapsed("compact build graph", [&] {
+            const abuild::CompactBuildGraph graph{cache};
+
+            for (std::uint32_t task = 0; task < graph.size(); ++task)
+            {
+                edges += graph.inputs(task).size() + graph.includePaths(task).size();
+            }
+        });
+
+        expect(cache.buildTasks().size()).toBe(libraries * (sourcesPerLibrary + 1));
+        expect(edges != 0).toBe(true);
+
+        std::filesystem::remove_all(root);
+    });
+
+    test("1000 modules with exported and private imports imported by 1000 sources", [] {
+        constexpr std::size_t libraries = 50;
+        constexpr std::size_t modulesPerLibrary = 20;
+        constexpr std::size_t sourcesPerLibrary = 20;
+        constexpr std::size_t importsPerFile = 6;
+        const std::filesystem::path root = generateLibraries("abuild_build_graph_benchmark", libraries, 0, modulesPerLibrary + sourcesPerLibrary);
+
+        abuild::BuildCache cache{root};
+        std::vector<abuild::Module *> modules;
+        std::vector<abuild::Source *> sources;
+        std::mt19937 generator{42};
+
+        auto addImports = [&](abuild::File *file, std::size_t count) {
+            for (std::size_t i = 0; i < importsPerFile && count != 0; ++i)
+            {
+                const std::size_t index = std::uniform_int_distribution<std::size_t>{0, count - 1}(generator);
+                const abuild::DependencyVisibility visibility = i == 0 ? abuild::DependencyVisibility::Public : abuild::DependencyVisibility::Private;
+                file->addDependency(abuild::ImportModuleDependency{.name = modules[index]->name, .mod = modules[index], .visibility = visibility});
+            }
+        };
+
+        for (std::size_t l = 0; l < libraries; ++l)
+        {
+            const std::string library = "library" + std::to_string(l);
+
+            for (std::size_t s = 0; s < modulesPerLibrary + sourcesPerLibrary; ++s)
+            {
+                sources.push_back(cache.addSource(root / library / ("source" + std::to_string(s) + ".cpp"), library));
+
+                if (s < modulesPerLibrary)
+                {
+                    modules.push_back(cache.addModuleInterface("module" + std::to_string(modules.size()), abuild::ModuleVisibility::Public, sources.back()));
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < modules.size(); ++i)
+        {
+            addImports(modules[i]->source, i);
+        }
+
+        for (abuild::Source *source : sources)
+        {
+            if (!cache.cppModule(source))
+            {
+                addImports(source, modules.size());
+            }
+        }
+
+        measureElapsed("build graph", [&] { abuild::BuildGraph{cache}; });
+
+        std::size_t edges = 0;
+
+        for (abuild::Source *source : sources)
+        {
+            std::visit([&](auto &&value) { edges += value.inputTasks.size(); }, *cache.buildTask(source));
+        }
+
+        std::cout << "    compile inputs: " << edges << '\n';
+
+        expect(cache.modules().size()).toBe(libraries * modulesPerLibrary);
+        expect(edges != 0).toBe(true);
+
+        std::filesystem::remove_all(root);
+    });
+});
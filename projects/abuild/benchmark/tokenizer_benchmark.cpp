@@ -0,0 +1,101 @@
+import abuild;
+import atest;
+
+using atest::expect;
+using atest::suite;
+using atest::test;
+
+[[nodiscard]] auto tokenize(std::string_view content, std::size_t preambleThreshold) -> std::size_t
+{
+    abuild::Tokenizer tokenizer{content, preambleThreshold};
+    std::size_t tokens = 0;
+
+    for (abuild::Token token = tokenizer.next(); !std::holds_alternative<std::monostate>(token); token = tokenizer.next())
+    {
+        tokens++;
+    }
+
+    return tokens;
+}
+
+[[nodiscard]] auto benchmark(const std::vector<std::string> &inputs, std::size_t iterations, std::size_t preambleThreshold) -> std::size_t
+{
+    std::size_t bytes = 0;
+    std::size_t tokens = 0;
+    const auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        for (const std::string &input : inputs)
+        {
+            bytes += input.size();
+            tokens += tokenize(input, preambleThreshold);
+        }
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::cout << "    " << tokens << " tokens, " << bytes / (1024 * 1024) << " MB, "
+              << static_cast<std::size_t>(static_cast<double>(tokens) / seconds) << " tokens/s, "
+              << static_cast<std::size_t>(static_cast<double>(bytes) / (1024 * 1024) / seconds) << " MB/s\n";
+
+    return tokens / iterations;
+}
+
+[[nodiscard]] auto generateCorpus(std::size_t size) -> std::string
+{
+    const std::vector<std::string> blocks = {
+        "/*\n * Copyright (c) Agnesoft\n * Licensed under the Apache License, Version 2.0\n */\n",
+        "#include <vector>\n#include \"my/header.hpp\"\n",
+        "export module mymodule;\nimport othermodule;\nexport import <string>;\nimport : mypartition;\n",
+        "namespace my\n{\nclass Foo\n{\npublic:\n    auto bar(int value) -> int\n    {\n        return value * 2; // doubles\n    }\n};\n}\n",
+        "const char *s = \"import notamodule;\";\nconst char *r = R\"raw(#include \"nothing.hpp\")raw\";\n",
+        "auto main(int argc, char *argv[]) -> int\n{\n    std::vector<int> values{1, 2, 3};\n    return static_cast<int>(values.size()) + argc;\n}\n"};
+
+    std::string corpus;
+    corpus.reserve(size + 1024);
+
+    for (std::size_t i = 0; corpus.size() < size; ++i)
+    {
+        corpus += blocks[i % blocks.size()];
+    }
+
+    return corpus;
+}
+
+static const auto testSuite = suite("abuild::Tokenizer (benchmark)", [] {
+    test("tokenizer_test inputs", [] {
+        const std::vector<std::string> inputs = {
+            "#include \"header.hpp\"",
+            "    #   include    <header.hpp>",
+            "/*\n\n*/#include/*\n\n*/\"header.hpp\"",
+            "module mymodule;",
+            "/*\n\n*/module/*\n\n*/mymodule/*\n\n*/;",
+            "module mymodule : mypartition;",
+            "import mymodule;",
+            "import : mypartition;",
+            "import \"header.hpp\";",
+            "import <header.hpp>;",
+            "export module mymodule;",
+            "export import mymodule;",
+            "export import : mypartition;",
+            "module;\nexport module mymodule;\nimport othermodule;\nexport import <vector>;\n#include \"my/header.hpp\"\nimport : mypartition;",
+            "module;\n/*\n some comment\n*/\n//some other comment\nexport module mymodule;\nauto foo() -> void\n{\n}\n\n\nimport othermodule;\nexport import <vector>;\nexport template<typename T> struct S\n{\n};\n\n#include \"my/header.hpp\"\nclass C;\nimport : mypartition;",
+            "const char *c = R\"asd(import : myotherpartition;import : quoted10;)asd\";import mymodule;c = \"import othermodule;\";import yetanothermodule;"};
+
+        expect(benchmark(inputs, 100000, 0)).toBe(std::size_t{25});
+    });
+
+    test("generated 100 MB corpus", [] {
+        const std::vector<std::string> inputs = {generateCorpus(100 * 1024 * 1024)};
+
+        expect(benchmark(inputs, 1, 0) > 0u).toBe(true);
+    });
+
+    test("generated 100 MB source (preamble only)", [] {
+        const std::vector<std::string> inputs = {"module;\n#include <cassert>\nexport module mymodule;\nimport othermodule;\nexport import <string>;\n" + generateCorpus(100 * 1024 * 1024)};
+
+        expect(benchmark(inputs, 1, 8)).toBe(std::size_t{10});
+    });
+});
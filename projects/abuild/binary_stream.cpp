@@ -0,0 +1,88 @@
+#ifdef _MSC_VER
+export module abuild : binary_stream;
+export import<astl.hpp>;
+#endif
+
+namespace abuild
+{
+class BinaryWriter
+{
+public:
+    [[nodiscard]] auto data() const noexcept -> const std::string &
+    {
+        return mData;
+    }
+
+    auto write(const std::string &value) -> void
+    {
+        write(static_cast<std::uint64_t>(value.size()));
+        mData.append(value);
+    }
+
+    auto write(const std::filesystem::path &value) -> void
+    {
+        write(value.string());
+    }
+
+    template<typename T>
+    requires std::is_integral_v<T> || std::is_enum_v<T>
+    auto write(T value) -> void
+    {
+        mData.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+private:
+    std::string mData;
+};
+
+class BinaryReader
+{
+public:
+    explicit BinaryReader(std::string_view data) noexcept :
+        mData{data}
+    {
+    }
+
+    [[nodiscard]] auto atEnd() const noexcept -> bool
+    {
+        return mPos == mData.size();
+    }
+
+    [[nodiscard]] auto readPath() -> std::filesystem::path
+    {
+        return std::filesystem::path{readString()};
+    }
+
+    [[nodiscard]] auto readString() -> std::string
+    {
+        const std::size_t size = read<std::uint64_t>();
+        require(size);
+        std::string value{mData.substr(mPos, size)};
+        mPos += size;
+        return value;
+    }
+
+    template<typename T>
+    requires std::is_integral_v<T> || std::is_enum_v<T>
+    [[nodiscard]] auto read() -> T
+    {
+        require(sizeof(T));
+        T value{};
+        std::memcpy(&value, mData.data() + mPos, sizeof(T));
+        mPos += sizeof(T);
+        return value;
+    }
+
+private:
+    auto require(std::size_t size) const -> void
+    {
+        if (mData.size() - mPos < size)
+        {
+            throw std::runtime_error{"Unexpected end of binary data."};
+        }
+    }
+
+    std::string_view mData;
+    std::size_t mPos = 0;
+};
+}
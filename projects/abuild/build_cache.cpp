@@ -5,10 +5,32 @@ export import : warning;
 export import : toolchain;
 export import : build_cache_index;
 export import : abuild_override;
+export import : arena;
+export import : trace;
+import : binary_stream;
+import : file_status_windows;
+import : thread_pool;
 #endif
 
 namespace abuild
 {
+export struct ChangedFiles
+{
+    std::vector<Source *> sources;
+    std::vector<Header *> headers;
+    std::vector<File *> removed;
+};
+
+export struct TaskState
+{
+    Digest fingerprint;
+    Digest outputHash;
+    Digest interfaceHash;
+    std::vector<FileStatus> outputs;
+
+    [[nodiscard]] auto operator==(const TaskState &other) const noexcept -> bool = default;
+};
+
 export class BuildCache
 {
 public:
@@ -18,6 +40,13 @@ public:
     }
 
     BuildCache(const std::filesystem::path &projectRoot) :
+        BuildCache(projectRoot, Arena::Mode::Pooled)
+    {
+    }
+
+    BuildCache(const std::filesystem::path &projectRoot, Arena::Mode mode) :
+        mArena{mode},
+        mBuildTaskArena{mode},
         mData{.projectRoot{projectRoot}, .dataOverride{projectRoot}}
     {
         mData.dataOverride.applyOverride(&mData.settings);
@@ -25,14 +54,14 @@ public:
 
     auto addBuildTask(const void *entity, BuildTask buildTask) -> BuildTask *
     {
-        BuildTask *task = mData.buildTasks.emplace_back(std::make_unique<BuildTask>(std::move(buildTask))).get();
+        BuildTask *task = mData.buildTasks.emplace_back(createBuildTask(std::move(buildTask)));
         mIndex.addBuildTask(entity, task);
         return task;
     }
 
     auto addBuildTask(const char *name, BuildTask buildTask) -> BuildTask *
     {
-        BuildTask *task = mData.buildTasks.emplace_back(std::make_unique<BuildTask>(std::move(buildTask))).get();
+        BuildTask *task = mData.buildTasks.emplace_back(createBuildTask(std::move(buildTask)));
         mIndex.addBuildTask(name, task);
         return task;
     }
@@ -45,9 +74,9 @@ public:
     auto addHeader(const std::filesystem::path &path, const std::string &projectName) -> Header *
     {
         Project *proj = getProject(projectName);
-        Header *header = mData.headers.emplace_back(std::make_unique<Header>(path, proj)).get();
+        Header *header = mData.headers.emplace_back(mArena.create<Header>(path, proj, mArena.resource()));
         proj->addHeader(header);
-        mIndex.addHeader(path.filename().string(), header);
+        mIndex.addHeader(header);
         return header;
     }
 
@@ -63,7 +92,7 @@ public:
     auto addModulePartition(const std::string &moduleName, std::string partitionName, ModuleVisibility visibility, Source *source) -> ModulePartition *
     {
         Module *mod = getCppModule(moduleName);
-        ModulePartition *partition = mData.modulePartitions.emplace_back(std::make_unique<ModulePartition>()).get();
+        ModulePartition *partition = mData.modulePartitions.emplace_back(mArena.create<ModulePartition>());
         mod->partitions.push_back(partition);
         partition->name = std::move(partitionName);
         partition->visibility = visibility;
@@ -76,15 +105,15 @@ public:
     auto addSource(const std::filesystem::path &path, const std::string &projectName) -> Source *
     {
         Project *proj = getProject(projectName);
-        Source *source = mData.sources.emplace_back(std::make_unique<Source>(path, proj)).get();
+        Source *source = mData.sources.emplace_back(mArena.create<Source>(path, proj, mArena.resource()));
         proj->addSource(source);
-        mIndex.addSource(path.filename().string(), source);
+        mIndex.addSource(source);
         return source;
     }
 
     auto addToolchain(Toolchain toolchain) -> Toolchain *
     {
-        return mData.toolchains.emplace_back(std::make_unique<Toolchain>(std::move(toolchain))).get();
+        return mData.toolchains.emplace_back(mArena.create<Toolchain>(std::move(toolchain)));
     }
 
     auto addWarning(Warning warning) -> void
@@ -92,7 +121,21 @@ public:
         mData.warnings.push_back(std::move(warning));
     }
 
-    [[nodiscard]] auto buildTasks() const noexcept -> const std::vector<std::unique_ptr<BuildTask>> &
+    [[nodiscard]] auto allocationStatistics() const noexcept -> AllocationStatistics
+    {
+        const AllocationStatistics entities = mArena.statistics();
+        const AllocationStatistics buildTasks = mBuildTaskArena.statistics();
+        AllocationStatistics statistics{.allocations = entities.allocations + buildTasks.allocations,
+                                        .bytes = entities.bytes + buildTasks.bytes,
+                                        .blockAllocations = entities.blockAllocations + buildTasks.blockAllocations,
+                                        .blockBytes = entities.blockBytes + buildTasks.blockBytes};
+
+        addHeapAllocations(mData.sources, &statistics);
+        addHeapAllocations(mData.headers, &statistics);
+        return statistics;
+    }
+
+    [[nodiscard]] auto buildTasks() const noexcept -> const std::vector<BuildTask *> &
     {
         return mData.buildTasks;
     }
@@ -107,6 +150,58 @@ public:
         return mIndex.buildTask(name);
     }
 
+    [[nodiscard]] auto changedFiles() const -> ChangedFiles
+    {
+        return changedFiles(std::thread::hardware_concurrency());
+    }
+
+    [[nodiscard]] auto changedFiles(std::size_t threads) const -> ChangedFiles
+    {
+        std::vector<File *> files;
+        files.reserve(mData.sources.size() + mData.headers.size());
+
+        for (Source *source : mData.sources)
+        {
+            files.push_back(source);
+        }
+
+        for (Header *header : mData.headers)
+        {
+            files.push_back(header);
+        }
+
+        const std::vector<std::optional<FileStatus>> statuses = fileStatuses(files, threads);
+        ChangedFiles changes;
+
+        for (std::size_t i = 0; i < files.size(); ++i)
+        {
+            if (!statuses[i])
+            {
+                changes.removed.push_back(files[i]);
+            }
+            else if (files[i]->isModified(*statuses[i]))
+            {
+                if (i < mData.sources.size())
+                {
+                    changes.sources.push_back(mData.sources[i]);
+                }
+                else
+                {
+                    changes.headers.push_back(mData.headers[i - mData.sources.size()]);
+                }
+            }
+        }
+
+        return changes;
+    }
+
+    auto clearBuildTasks() -> void
+    {
+        mData.buildTasks.clear();
+        mBuildTaskArena.clear();
+        mIndex.clearBuildTasks();
+    }
+
     [[nodiscard]] auto cppModule(const File *file) const -> Module *
     {
         return mIndex.cppModule(file);
@@ -127,22 +222,72 @@ public:
         return mData.errors;
     }
 
-    [[nodiscard]] auto header(const std::filesystem::path &file) const -> Header *
+    [[nodiscard]] auto header(std::string_view file) const -> Header *
     {
-        return header(file, {});
+        return mIndex.header(file, std::filesystem::path{});
     }
 
-    [[nodiscard]] auto header(const std::filesystem::path &file, const std::filesystem::path &hint) const -> Header *
+    [[nodiscard]] auto header(std::string_view file, const std::filesystem::path &hint) const -> Header *
     {
         return mIndex.header(file, hint);
     }
 
-    [[nodiscard]] auto headers() const noexcept -> const std::vector<std::unique_ptr<Header>> &
+    [[nodiscard]] auto header(std::string_view file, const File *includer) const -> Header *
+    {
+        return mIndex.header(file, includer);
+    }
+
+    [[nodiscard]] auto directories() const noexcept -> const std::vector<std::filesystem::path> &
+    {
+        return mData.directories;
+    }
+
+    [[nodiscard]] auto headers() const noexcept -> const std::vector<Header *> &
     {
         return mData.headers;
     }
 
-    [[nodiscard]] auto modules() const noexcept -> const std::vector<std::unique_ptr<Module>> &
+    [[nodiscard]] auto load(const std::filesystem::path &path) -> bool
+    {
+        if (!std::filesystem::exists(path))
+        {
+            return false;
+        }
+
+        try
+        {
+            const FileView view{path};
+            BinaryReader reader{view.content()};
+
+            if (reader.read<std::uint32_t>() == SNAPSHOT_MAGIC && reader.read<std::uint32_t>() == SNAPSHOT_VERSION && readTaskDurations(reader) && readTaskStates(reader) && readStamps(reader))
+            {
+                readProjects(reader);
+                mData.directories = readPaths(reader);
+                readFiles(reader, &mData.sources);
+                readFiles(reader, &mData.headers);
+                readModules(reader);
+                readModulePartitions(reader);
+                readDependencies(reader, mData.sources);
+                readDependencies(reader, mData.headers);
+                readToolchains(reader);
+                readMessages(reader, &mData.errors);
+                readMessages(reader, &mData.warnings);
+
+                if (reader.atEnd())
+                {
+                    return true;
+                }
+            }
+        }
+        catch ([[maybe_unused]] std::exception &e)
+        {
+        }
+
+        reset();
+        return false;
+    }
+
+    [[nodiscard]] auto modules() const noexcept -> const std::vector<Module *> &
     {
         return mData.modules;
     }
@@ -157,45 +302,209 @@ public:
         return mData.projectRoot;
     }
 
-    [[nodiscard]] auto projects() const noexcept -> const std::vector<std::unique_ptr<Project>> &
+    [[nodiscard]] auto projects() const noexcept -> const std::vector<Project *> &
     {
         return mData.projects;
     }
 
+    auto removeWarnings(const File *file) -> void
+    {
+        const std::string suffix = '(' + file->path().string() + ')';
+
+        std::erase_if(mData.warnings, [&](const Warning &warning) {
+            return warning.what.ends_with(suffix);
+        });
+    }
+
+    auto removeWarnings(const File *file, std::string_view component) -> void
+    {
+        const std::string suffix = '(' + file->path().string() + ')';
+
+        std::erase_if(mData.warnings, [&](const Warning &warning) {
+            return warning.component == component && warning.what.ends_with(suffix);
+        });
+    }
+
+    auto save(const std::filesystem::path &path) const -> void
+    {
+        std::filesystem::create_directories(path.parent_path());
+
+        std::unordered_map<const void *, std::uint64_t> ids;
+        BinaryWriter writer;
+        writer.write(SNAPSHOT_MAGIC);
+        writer.write(SNAPSHOT_VERSION);
+        writeTaskDurations(writer);
+        writeTaskStates(writer);
+        writeStamps(writer);
+        writeProjects(writer, &ids);
+        writePaths(writer, mData.directories);
+        writeFiles(writer, mData.sources, &ids);
+        writeFiles(writer, mData.headers, &ids);
+        writeModules(writer, &ids);
+        writeModulePartitions(writer, &ids);
+        writeDependencies(writer, mData.sources, ids);
+        writeDependencies(writer, mData.headers, ids);
+        writeToolchains(writer);
+        writeMessages(writer, mData.errors);
+        writeMessages(writer, mData.warnings);
+
+        std::ofstream file{path, std::ios::binary | std::ios::trunc};
+        file.write(writer.data().data(), static_cast<std::streamsize>(writer.data().size()));
+
+        if (!file)
+        {
+            throw std::runtime_error{"Failed to write build cache snapshot '" + path.string() + "'."};
+        }
+    }
+
+    auto setDirectories(std::vector<std::filesystem::path> directories) -> void
+    {
+        mData.directories = std::move(directories);
+    }
+
+    auto setTaskDuration(const BuildTask &task, std::chrono::milliseconds duration) -> void
+    {
+        mData.taskDurations.insert_or_assign(taskName(task), duration);
+    }
+
+    auto setTaskDurations(std::unordered_map<std::string, std::chrono::milliseconds> durations) -> void
+    {
+        mData.taskDurations = std::move(durations);
+    }
+
+    auto setTaskState(const BuildTask &task, TaskState state) -> void
+    {
+        mData.taskStates.insert_or_assign(taskName(task), std::move(state));
+    }
+
+    auto setTaskStates(std::unordered_map<std::string, TaskState> states) -> void
+    {
+        mData.taskStates = std::move(states);
+    }
+
     [[nodiscard]] auto settings() const noexcept -> const Settings &
     {
         return mData.settings;
     }
 
-    [[nodiscard]] auto source(const std::filesystem::path &file) const -> Source *
+    [[nodiscard]] auto source(std::string_view file) const -> Source *
     {
-        return source(file, {});
+        return mIndex.source(file, std::filesystem::path{});
     }
 
-    [[nodiscard]] auto source(const std::filesystem::path &file, const std::filesystem::path &hint) const -> Source *
+    [[nodiscard]] auto source(std::string_view file, const std::filesystem::path &hint) const -> Source *
     {
         return mIndex.source(file, hint);
     }
 
-    [[nodiscard]] auto sources() const noexcept -> const std::vector<std::unique_ptr<Source>> &
+    [[nodiscard]] auto source(std::string_view file, const File *includer) const -> Source *
+    {
+        return mIndex.source(file, includer);
+    }
+
+    [[nodiscard]] auto sources() const noexcept -> const std::vector<Source *> &
     {
         return mData.sources;
     }
 
+    [[nodiscard]] auto taskDuration(const BuildTask &task) const -> std::optional<std::chrono::milliseconds>
+    {
+        std::unordered_map<std::string, std::chrono::milliseconds>::const_iterator it = mData.taskDurations.find(taskName(task));
+
+        if (it != mData.taskDurations.end())
+        {
+            return it->second;
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+
+    [[nodiscard]] auto taskDurations() const noexcept -> const std::unordered_map<std::string, std::chrono::milliseconds> &
+    {
+        return mData.taskDurations;
+    }
+
+    [[nodiscard]] auto taskState(const BuildTask &task) const -> const TaskState *
+    {
+        std::unordered_map<std::string, TaskState>::const_iterator it = mData.taskStates.find(taskName(task));
+
+        if (it != mData.taskStates.end())
+        {
+            return &it->second;
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    [[nodiscard]] auto taskStates() const noexcept -> const std::unordered_map<std::string, TaskState> &
+    {
+        return mData.taskStates;
+    }
+
+    [[nodiscard]] auto taskName(const BuildTask &task) const -> std::string
+    {
+        return std::visit([&](auto &&value) -> std::string {
+            using T = std::decay_t<decltype(value)>;
+
+            if constexpr (std::is_same_v<T, CompileHeaderUnitTask>)
+            {
+                return "compile header unit " + relativePath(value.header->path());
+            }
+            else if constexpr (std::is_same_v<T, CompileSTLHeaderUnitTask>)
+            {
+                return "compile STL header unit " + value.name;
+            }
+            else if constexpr (std::is_same_v<T, CompileModuleInterfaceTask>)
+            {
+                return "compile module interface " + relativePath(value.source->path());
+            }
+            else if constexpr (std::is_same_v<T, CompileModulePartitionTask>)
+            {
+                return "compile module partition " + relativePath(value.source->path());
+            }
+            else if constexpr (std::is_same_v<T, CompileSourceTask>)
+            {
+                return "compile " + relativePath(value.source->path());
+            }
+            else if constexpr (std::is_same_v<T, LinkExecutableTask>)
+            {
+                return "link executable " + value.project->name();
+            }
+            else if constexpr (std::is_same_v<T, LinkLibraryTask>)
+            {
+                return "link library " + value.project->name();
+            }
+            else
+            {
+                return "link module library " + value.mod->name;
+            }
+        },
+                          task);
+    }
+
+    [[nodiscard]] auto trace() noexcept -> Trace &
+    {
+        return mTrace;
+    }
+
     [[nodiscard]] auto toolchain(const std::string &name) const -> Toolchain *
     {
-        for (const std::unique_ptr<Toolchain> &toolchain : mData.toolchains)
+        for (Toolchain *toolchain : mData.toolchains)
         {
             if (toolchain->name.starts_with(name))
             {
-                return toolchain.get();
+                return toolchain;
             }
         }
 
         return nullptr;
     }
 
-    [[nodiscard]] auto toolchains() const noexcept -> const std::vector<std::unique_ptr<Toolchain>> &
+    [[nodiscard]] auto toolchains() const noexcept -> const std::vector<Toolchain *> &
     {
         return mData.toolchains;
     }
@@ -208,27 +517,129 @@ public:
 private:
     struct Data
     {
-        std::vector<std::unique_ptr<Project>> projects;
-        std::vector<std::unique_ptr<Source>> sources;
-        std::vector<std::unique_ptr<Header>> headers;
-        std::vector<std::unique_ptr<Module>> modules;
-        std::vector<std::unique_ptr<ModulePartition>> modulePartitions;
-        std::vector<std::unique_ptr<BuildTask>> buildTasks;
-        std::vector<std::unique_ptr<Toolchain>> toolchains;
+        std::vector<Project *> projects;
+        std::vector<Source *> sources;
+        std::vector<Header *> headers;
+        std::vector<Module *> modules;
+        std::vector<ModulePartition *> modulePartitions;
+        std::vector<BuildTask *> buildTasks;
+        std::vector<Toolchain *> toolchains;
         std::vector<Error> errors;
         std::vector<Warning> warnings;
+        std::vector<std::filesystem::path> directories;
         std::filesystem::path projectRoot;
         Settings settings;
         Override dataOverride;
+        std::unordered_map<std::string, std::chrono::milliseconds> taskDurations;
+        std::unordered_map<std::string, TaskState> taskStates;
     };
 
+    static constexpr std::uint32_t SNAPSHOT_MAGIC = 0x43424241;
+    static constexpr std::uint32_t SNAPSHOT_VERSION = 9;
+    static constexpr std::size_t STATUS_BATCH_SIZE = 256;
+
+    template<typename T>
+    static auto addHeapAllocations(const std::vector<T *> &files, AllocationStatistics *statistics) noexcept -> void
+    {
+        const std::size_t smallCapacity = std::string{}.capacity();
+
+        for (T *file : files)
+        {
+            for (const Dependency &dependency : file->dependencies())
+            {
+                const std::size_t capacity = std::visit([](auto &&value) { return value.name.capacity(); }, dependency);
+
+                if (capacity > smallCapacity)
+                {
+                    ++statistics->heapAllocations;
+                    statistics->heapBytes += capacity + 1;
+                }
+            }
+        }
+    }
+
+    template<typename T>
+    [[nodiscard]] static auto at(const std::vector<T *> &entities, std::uint64_t id) -> T *
+    {
+        if (id == 0)
+        {
+            return nullptr;
+        }
+
+        if (id > entities.size())
+        {
+            throw std::runtime_error{"Invalid build cache snapshot entity id."};
+        }
+
+        return entities[id - 1];
+    }
+
+    [[nodiscard]] auto createBuildTask(BuildTask buildTask) -> BuildTask *
+    {
+        BuildTask *task = mBuildTaskArena.create<BuildTask>(std::move(buildTask));
+
+        std::visit([this](auto &&value) {
+            moveToArena(&value.inputTasks);
+
+            if constexpr (requires { value.includePaths; })
+            {
+                moveToArena(&value.includePaths);
+            }
+        },
+                   *task);
+
+        return task;
+    }
+
+    [[nodiscard]] static auto id(const std::unordered_map<const void *, std::uint64_t> &ids, const void *entity) -> std::uint64_t
+    {
+        const auto it = ids.find(entity);
+        return it == ids.end() ? 0 : it->second;
+    }
+
+    [[nodiscard]] static auto fileStatuses(const std::vector<File *> &files, std::size_t threads) -> std::vector<std::optional<FileStatus>>
+    {
+        std::vector<std::optional<FileStatus>> statuses(files.size());
+
+        const auto readStatuses = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                try
+                {
+                    statuses[i] = fileStatus(files[i]->path());
+                }
+                catch ([[maybe_unused]] std::filesystem::filesystem_error &e)
+                {
+                }
+            }
+        };
+
+        if (threads <= 1 || files.size() <= STATUS_BATCH_SIZE)
+        {
+            readStatuses(0, files.size());
+        }
+        else
+        {
+            ThreadPool pool{std::min(threads, (files.size() + STATUS_BATCH_SIZE - 1) / STATUS_BATCH_SIZE)};
+
+            for (std::size_t begin = 0; begin < files.size(); begin += STATUS_BATCH_SIZE)
+            {
+                pool.run([&, begin] { readStatuses(begin, std::min(begin + STATUS_BATCH_SIZE, files.size())); });
+            }
+
+            pool.wait();
+        }
+
+        return statuses;
+    }
+
     [[nodiscard]] auto getCppModule(const std::string &name) -> Module *
     {
         Module *mod = mIndex.cppModule(name);
 
         if (!mod)
         {
-            mod = mData.modules.emplace_back(std::make_unique<Module>()).get();
+            mod = mData.modules.emplace_back(mArena.create<Module>());
             mod->name = name;
             mIndex.addModule(name, mod);
         }
@@ -242,14 +653,554 @@ private:
 
         if (!proj)
         {
-            proj = mData.projects.emplace_back(std::make_unique<Project>(name)).get();
+            proj = mData.projects.emplace_back(mArena.create<Project>(name));
             mIndex.addProject(name, proj);
         }
 
         return proj;
     }
 
+    template<typename T>
+    auto moveToArena(T *set) -> void
+    {
+        *set = T{set->begin(), set->end(), set->bucket_count(), set->hash_function(), set->key_eq(), mBuildTaskArena.resource()};
+    }
+
+    template<typename T>
+    auto readDependencies(BinaryReader &reader, const std::vector<T *> &files) -> void
+    {
+        for (T *file : files)
+        {
+            const std::uint64_t count = reader.read<std::uint64_t>();
+
+            for (std::uint64_t i = 0; i < count; ++i)
+            {
+                file->addDependency(readDependency(reader));
+            }
+        }
+    }
+
+    [[nodiscard]] auto readDependency(BinaryReader &reader) -> Dependency
+    {
+        const auto type = reader.read<std::uint8_t>();
+        std::string name = reader.readString();
+        const auto visibility = reader.read<DependencyVisibility>();
+
+        switch (type)
+        {
+        case 0:
+            return IncludeExternalHeaderDependency{.name = std::move(name), .header = at(mData.headers, reader.read<std::uint64_t>()), .visibility = visibility};
+        case 1:
+            return IncludeExternalSourceDependency{.name = std::move(name), .source = at(mData.sources, reader.read<std::uint64_t>()), .visibility = visibility};
+        case 2:
+            return IncludeLocalHeaderDependency{.name = std::move(name), .header = at(mData.headers, reader.read<std::uint64_t>()), .visibility = visibility};
+        case 3:
+            return IncludeLocalSourceDependency{.name = std::move(name), .source = at(mData.sources, reader.read<std::uint64_t>()), .visibility = visibility};
+        case 4:
+            return IncludeSTLHeaderDependency{.name = std::move(name), .visibility = visibility};
+        case 5:
+            return ImportExternalHeaderDependency{.name = std::move(name), .header = at(mData.headers, reader.read<std::uint64_t>()), .visibility = visibility};
+        case 6:
+            return ImportLocalHeaderDependency{.name = std::move(name), .header = at(mData.headers, reader.read<std::uint64_t>()), .visibility = visibility};
+        case 7:
+            return ImportModuleDependency{.name = std::move(name), .mod = at(mData.modules, reader.read<std::uint64_t>()), .visibility = visibility};
+        case 8:
+            return ImportModulePartitionDependency{.name = std::move(name), .partition = at(mData.modulePartitions, reader.read<std::uint64_t>()), .visibility = visibility};
+        case 9:
+            return ImportSTLHeaderDependency{.name = std::move(name), .visibility = visibility};
+        default:
+            throw std::runtime_error{"Invalid build cache snapshot dependency type."};
+        }
+    }
+
+    [[nodiscard]] static auto readDigest(BinaryReader &reader) -> Digest
+    {
+        Digest digest;
+        digest.low = reader.read<std::uint64_t>();
+        digest.high = reader.read<std::uint64_t>();
+        return digest;
+    }
+
+    template<typename T>
+    auto readFiles(BinaryReader &reader, std::vector<T *> *files) -> void
+    {
+        const std::uint64_t count = reader.read<std::uint64_t>();
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            const std::filesystem::path path = reader.readPath();
+            Project *proj = at(mData.projects, reader.read<std::uint64_t>());
+            const FileStatus status = readStatus(reader);
+            T *file = files->emplace_back(mArena.create<T>(path, proj, status, mArena.resource()));
+            file->setContentHash(readDigest(reader));
+
+            if constexpr (std::is_same_v<T, Source>)
+            {
+                proj->addSource(file);
+                mIndex.addSource(file);
+            }
+            else
+            {
+                proj->addHeader(file);
+                mIndex.addHeader(file);
+            }
+        }
+    }
+
+    template<typename T>
+    static auto readMessages(BinaryReader &reader, std::vector<T> *messages) -> void
+    {
+        const std::uint64_t count = reader.read<std::uint64_t>();
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            std::string component = reader.readString();
+            messages->push_back(T{.component = std::move(component), .what = reader.readString()});
+        }
+    }
+
+    auto readModulePartitions(BinaryReader &reader) -> void
+    {
+        const std::uint64_t count = reader.read<std::uint64_t>();
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            ModulePartition *partition = mData.modulePartitions.emplace_back(mArena.create<ModulePartition>());
+            partition->name = reader.readString();
+            partition->visibility = reader.read<ModuleVisibility>();
+            partition->source = at(mData.sources, reader.read<std::uint64_t>());
+            partition->mod = at(mData.modules, reader.read<std::uint64_t>());
+
+            if (!partition->mod)
+            {
+                throw std::runtime_error{"Invalid build cache snapshot module partition."};
+            }
+
+            partition->mod->partitions.push_back(partition);
+
+            if (partition->source)
+            {
+                mIndex.addModulePartitionFile(partition->source, partition);
+            }
+        }
+    }
+
+    auto readModules(BinaryReader &reader) -> void
+    {
+        const std::uint64_t count = reader.read<std::uint64_t>();
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            Module *mod = getCppModule(reader.readString());
+            mod->visibility = reader.read<ModuleVisibility>();
+            mod->source = at(mData.sources, reader.read<std::uint64_t>());
+
+            if (mod->source)
+            {
+                mIndex.addModuleFile(mod->source, mod);
+            }
+        }
+    }
+
+    auto readProjects(BinaryReader &reader) -> void
+    {
+        const std::uint64_t count = reader.read<std::uint64_t>();
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            Project *proj = getProject(reader.readString());
+            proj->setType(reader.read<Project::Type>());
+        }
+    }
+
+    [[nodiscard]] static auto readStamps(BinaryReader &reader) -> bool
+    {
+        const std::uint64_t count = reader.read<std::uint64_t>();
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            const std::filesystem::path path = reader.readPath();
+
+            if (reader.read<std::int64_t>() != stamp(path))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] static auto readStatus(BinaryReader &reader) -> FileStatus
+    {
+        FileStatus status;
+        status.timestamp = reader.read<std::int64_t>();
+        status.size = reader.read<std::uint64_t>();
+        status.device = reader.read<std::uint64_t>();
+        status.inode = reader.read<std::uint64_t>();
+        return status;
+    }
+
+    [[nodiscard]] static auto readPaths(BinaryReader &reader) -> std::vector<std::filesystem::path>
+    {
+        const std::uint64_t count = reader.read<std::uint64_t>();
+        std::vector<std::filesystem::path> paths;
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            paths.push_back(reader.readPath());
+        }
+
+        return paths;
+    }
+
+    [[nodiscard]] static auto readStringSet(BinaryReader &reader) -> std::unordered_set<std::string>
+    {
+        const std::uint64_t count = reader.read<std::uint64_t>();
+        std::unordered_set<std::string> values;
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            values.insert(reader.readString());
+        }
+
+        return values;
+    }
+
+    [[nodiscard]] auto readTaskDurations(BinaryReader &reader) -> bool
+    {
+        const std::uint64_t count = reader.read<std::uint64_t>();
+        std::unordered_map<std::string, std::chrono::milliseconds> durations;
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            std::string name = reader.readString();
+            durations.insert({std::move(name), std::chrono::milliseconds{reader.read<std::int64_t>()}});
+        }
+
+        mData.taskDurations = std::move(durations);
+        return true;
+    }
+
+    [[nodiscard]] auto readTaskStates(BinaryReader &reader) -> bool
+    {
+        const std::uint64_t count = reader.read<std::uint64_t>();
+        std::unordered_map<std::string, TaskState> states;
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            std::string name = reader.readString();
+            TaskState state;
+            state.fingerprint = readDigest(reader);
+            state.outputHash = readDigest(reader);
+            state.interfaceHash = readDigest(reader);
+            const std::uint64_t outputs = reader.read<std::uint64_t>();
+
+            for (std::uint64_t output = 0; output < outputs; ++output)
+            {
+                state.outputs.push_back(readStatus(reader));
+            }
+
+            states.insert({std::move(name), std::move(state)});
+        }
+
+        mData.taskStates = std::move(states);
+        return true;
+    }
+
+    auto readToolchains(BinaryReader &reader) -> void
+    {
+        const std::uint64_t count = reader.read<std::uint64_t>();
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            Toolchain *toolchain = mData.toolchains.emplace_back(mArena.create<Toolchain>());
+            toolchain->name = reader.readString();
+            toolchain->type = reader.read<Toolchain::Type>();
+            toolchain->compiler = reader.readPath();
+            toolchain->linker = reader.readPath();
+            toolchain->archiver = reader.readPath();
+            toolchain->compilerFlags = readStringSet(reader);
+            toolchain->linkerFlags = readStringSet(reader);
+            toolchain->archiverFlags = readStringSet(reader);
+            toolchain->includePath = reader.readPath();
+            toolchain->libPath = reader.readPath();
+            toolchain->systemIncludePaths = readPaths(reader);
+        }
+    }
+
+    [[nodiscard]] auto relativePath(const std::filesystem::path &path) const -> std::string
+    {
+        const std::filesystem::path relative = path.lexically_relative(mData.projectRoot);
+        return relative.empty() ? path.string() : relative.generic_string();
+    }
+
+    auto reset() -> void
+    {
+        mData.projects.clear();
+        mData.sources.clear();
+        mData.headers.clear();
+        mData.modules.clear();
+        mData.modulePartitions.clear();
+        mData.buildTasks.clear();
+        mData.toolchains.clear();
+        mData.errors.clear();
+        mData.warnings.clear();
+        mData.directories.clear();
+        mIndex = BuildCacheIndex{};
+        mArena.clear();
+        mBuildTaskArena.clear();
+    }
+
+    [[nodiscard]] static auto stamp(const std::filesystem::path &path) -> std::int64_t
+    {
+        std::error_code error;
+        const std::filesystem::file_time_type time = std::filesystem::last_write_time(path, error);
+        return error ? -1 : static_cast<std::int64_t>(time.time_since_epoch().count());
+    }
+
+    [[nodiscard]] auto stampedPaths() const -> std::set<std::filesystem::path>
+    {
+        const std::filesystem::path root = std::filesystem::weakly_canonical(mData.projectRoot);
+        std::set<std::filesystem::path> paths{root};
+
+        for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(root))
+        {
+            if (entry.is_regular_file() && (entry.path().filename().string() == ".abuild" || entry.path().extension().string() == ".abuild"))
+            {
+                paths.insert(entry.path());
+            }
+        }
+
+        const auto addDirectories = [&](const File &file) {
+            for (std::filesystem::path directory = file.path().parent_path(); directory != root && directory != directory.parent_path() && paths.insert(directory).second; directory = directory.parent_path())
+            {
+            }
+        };
+
+        for (const std::filesystem::path &directory : mData.directories)
+        {
+            paths.insert(std::filesystem::weakly_canonical(directory));
+        }
+
+        for (Source *source : mData.sources)
+        {
+            addDirectories(*source);
+        }
+
+        for (Header *header : mData.headers)
+        {
+            addDirectories(*header);
+        }
+
+        return paths;
+    }
+
+    template<typename T>
+    static auto writeDependencies(BinaryWriter &writer, const std::vector<T *> &files, const std::unordered_map<const void *, std::uint64_t> &ids) -> void
+    {
+        for (T *file : files)
+        {
+            writer.write(static_cast<std::uint64_t>(file->dependencies().size()));
+
+            for (const Dependency &dependency : file->dependencies())
+            {
+                writer.write(static_cast<std::uint8_t>(dependency.index()));
+                std::visit([&](auto &&dep) {
+                    writer.write(dep.name);
+                    writer.write(dep.visibility);
+
+                    if constexpr (requires { dep.header; })
+                    {
+                        writer.write(id(ids, dep.header));
+                    }
+                    else if constexpr (requires { dep.source; })
+                    {
+                        writer.write(id(ids, dep.source));
+                    }
+                    else if constexpr (requires { dep.mod; })
+                    {
+                        writer.write(id(ids, dep.mod));
+                    }
+                    else if constexpr (requires { dep.partition; })
+                    {
+                        writer.write(id(ids, dep.partition));
+                    }
+                },
+                           dependency);
+            }
+        }
+    }
+
+    static auto writeDigest(BinaryWriter &writer, const Digest &digest) -> void
+    {
+        writer.write(digest.low);
+        writer.write(digest.high);
+    }
+
+    template<typename T>
+    static auto writeFiles(BinaryWriter &writer, const std::vector<T *> &files, std::unordered_map<const void *, std::uint64_t> *ids) -> void
+    {
+        writer.write(static_cast<std::uint64_t>(files.size()));
+
+        for (std::size_t i = 0; i < files.size(); ++i)
+        {
+            T *file = files[i];
+            ids->insert({file, i + 1});
+            writer.write(file->path());
+            writer.write(id(*ids, file->project()));
+            writeStatus(writer, file->status());
+            writeDigest(writer, file->contentHash());
+        }
+    }
+
+    template<typename T>
+    static auto writeMessages(BinaryWriter &writer, const std::vector<T> &messages) -> void
+    {
+        writer.write(static_cast<std::uint64_t>(messages.size()));
+
+        for (const T &message : messages)
+        {
+            writer.write(message.component);
+            writer.write(message.what);
+        }
+    }
+
+    auto writeModulePartitions(BinaryWriter &writer, std::unordered_map<const void *, std::uint64_t> *ids) const -> void
+    {
+        writer.write(static_cast<std::uint64_t>(mData.modulePartitions.size()));
+
+        for (std::size_t i = 0; i < mData.modulePartitions.size(); ++i)
+        {
+            const ModulePartition *partition = mData.modulePartitions[i];
+            ids->insert({partition, i + 1});
+            writer.write(partition->name);
+            writer.write(partition->visibility);
+            writer.write(id(*ids, partition->source));
+            writer.write(id(*ids, partition->mod));
+        }
+    }
+
+    auto writeModules(BinaryWriter &writer, std::unordered_map<const void *, std::uint64_t> *ids) const -> void
+    {
+        writer.write(static_cast<std::uint64_t>(mData.modules.size()));
+
+        for (std::size_t i = 0; i < mData.modules.size(); ++i)
+        {
+            const Module *mod = mData.modules[i];
+            ids->insert({mod, i + 1});
+            writer.write(mod->name);
+            writer.write(mod->visibility);
+            writer.write(id(*ids, mod->source));
+        }
+    }
+
+    auto writeProjects(BinaryWriter &writer, std::unordered_map<const void *, std::uint64_t> *ids) const -> void
+    {
+        writer.write(static_cast<std::uint64_t>(mData.projects.size()));
+
+        for (std::size_t i = 0; i < mData.projects.size(); ++i)
+        {
+            const Project *proj = mData.projects[i];
+            ids->insert({proj, i + 1});
+            writer.write(proj->name());
+            writer.write(proj->type());
+        }
+    }
+
+    auto writeStamps(BinaryWriter &writer) const -> void
+    {
+        const std::set<std::filesystem::path> paths = stampedPaths();
+        writer.write(static_cast<std::uint64_t>(paths.size()));
+
+        for (const std::filesystem::path &path : paths)
+        {
+            writer.write(path);
+            writer.write(stamp(path));
+        }
+    }
+
+    static auto writeStatus(BinaryWriter &writer, const FileStatus &status) -> void
+    {
+        writer.write(status.timestamp);
+        writer.write(status.size);
+        writer.write(status.device);
+        writer.write(status.inode);
+    }
+
+    static auto writePaths(BinaryWriter &writer, const std::vector<std::filesystem::path> &paths) -> void
+    {
+        writer.write(static_cast<std::uint64_t>(paths.size()));
+
+        for (const std::filesystem::path &path : paths)
+        {
+            writer.write(path);
+        }
+    }
+
+    static auto writeStringSet(BinaryWriter &writer, const std::unordered_set<std::string> &values) -> void
+    {
+        writer.write(static_cast<std::uint64_t>(values.size()));
+
+        for (const std::string &value : values)
+        {
+            writer.write(value);
+        }
+    }
+
+    auto writeTaskDurations(BinaryWriter &writer) const -> void
+    {
+        writer.write(static_cast<std::uint64_t>(mData.taskDurations.size()));
+
+        for (const std::pair<const std::string, std::chrono::milliseconds> &duration : mData.taskDurations)
+        {
+            writer.write(duration.first);
+            writer.write(static_cast<std::int64_t>(duration.second.count()));
+        }
+    }
+
+    auto writeTaskStates(BinaryWriter &writer) const -> void
+    {
+        writer.write(static_cast<std::uint64_t>(mData.taskStates.size()));
+
+        for (const std::pair<const std::string, TaskState> &state : mData.taskStates)
+        {
+            writer.write(state.first);
+            writeDigest(writer, state.second.fingerprint);
+            writeDigest(writer, state.second.outputHash);
+            writeDigest(writer, state.second.interfaceHash);
+            writer.write(static_cast<std::uint64_t>(state.second.outputs.size()));
+
+            for (const FileStatus &status : state.second.outputs)
+            {
+                writeStatus(writer, status);
+            }
+        }
+    }
+
+    auto writeToolchains(BinaryWriter &writer) const -> void
+    {
+        writer.write(static_cast<std::uint64_t>(mData.toolchains.size()));
+
+        for (Toolchain *toolchain : mData.toolchains)
+        {
+            writer.write(toolchain->name);
+            writer.write(toolchain->type);
+            writer.write(toolchain->compiler);
+            writer.write(toolchain->linker);
+            writer.write(toolchain->archiver);
+            writeStringSet(writer, toolchain->compilerFlags);
+            writeStringSet(writer, toolchain->linkerFlags);
+            writeStringSet(writer, toolchain->archiverFlags);
+            writer.write(toolchain->includePath);
+            writer.write(toolchain->libPath);
+            writePaths(writer, toolchain->systemIncludePaths);
+        }
+    }
+
+    Arena mArena;
+    Arena mBuildTaskArena;
     Data mData;
     BuildCacheIndex mIndex;
+    Trace mTrace;
 };
 }
@@ -5,6 +5,8 @@ export import : header;
 export import : source;
 export import : cpp_module;
 export import : build_task;
+import : string_interner;
+import : suffix_trie;
 #endif
 
 namespace abuild
@@ -19,17 +21,17 @@ public:
 
     auto addBuildTask(const char *name, BuildTask *task) -> void
     {
-        mBuildTaskNameIndex.insert({name, task});
+        mBuildTaskNameIndex.insert({mStrings.intern(name), task});
     }
 
-    auto addHeader(const std::string &name, Header *header) -> void
+    auto addHeader(Header *header) -> void
     {
-        mHeaderIndex.insert({name, header});
+        addFile(header, &mHeaderIndex);
     }
 
     auto addModule(const std::string &name, Module *mod) -> void
     {
-        mModuleIndex.insert({name, mod});
+        mModuleIndex.insert({mStrings.intern(name), mod});
     }
 
     auto addModuleFile(const File *file, Module *mod) -> void
@@ -44,12 +46,12 @@ public:
 
     auto addProject(const std::string &name, Project *proj) -> void
     {
-        mProjectIndex.insert({name, proj});
+        mProjectIndex.insert({mStrings.intern(name), proj});
     }
 
-    auto addSource(const std::string &name, Source *source) -> void
+    auto addSource(Source *source) -> void
     {
-        mSourceIndex.insert({name, source});
+        addFile(source, &mSourceIndex);
     }
 
     [[nodiscard]] auto buildTask(const void *entity) const -> BuildTask *
@@ -68,7 +70,7 @@ public:
 
     [[nodiscard]] auto buildTask(const char *name) const -> BuildTask *
     {
-        std::unordered_map<std::string, BuildTask *>::const_iterator it = mBuildTaskNameIndex.find(name);
+        std::unordered_map<std::uint32_t, BuildTask *>::const_iterator it = mBuildTaskNameIndex.find(mStrings.find(name));
 
         if (it != mBuildTaskNameIndex.end())
         {
@@ -80,33 +82,20 @@ public:
         }
     }
 
-    [[nodiscard]] auto header(const std::filesystem::path &file, const std::filesystem::path &hint) const -> Header *
+    auto clearBuildTasks() -> void
     {
-        using It = std::unordered_multimap<std::string, Header *>::const_iterator;
-        std::pair<It, It> range = mHeaderIndex.equal_range(file.filename().string());
-
-        if (!hint.empty())
-        {
-            const std::filesystem::path hintedPath = (hint / file).lexically_normal();
-
-            for (It it = range.first; it != range.second; ++it)
-            {
-                if (it->second->path() == hintedPath)
-                {
-                    return it->second;
-                }
-            }
-        }
+        mBuildTaskIndex.clear();
+        mBuildTaskNameIndex.clear();
+    }
 
-        for (It it = range.first; it != range.second; ++it)
-        {
-            if (isSame(it->second->path(), file))
-            {
-                return it->second;
-            }
-        }
+    [[nodiscard]] auto header(std::string_view file, const std::filesystem::path &hint) const -> Header *
+    {
+        return find(file, hintedDirectory(file, hint), mHeaderIndex);
+    }
 
-        return nullptr;
+    [[nodiscard]] auto header(std::string_view file, const File *includer) const -> Header *
+    {
+        return find(file, hintedDirectory(file, includer), mHeaderIndex);
     }
 
     [[nodiscard]] auto cppModule(const File *file) const -> Module *
@@ -125,7 +114,7 @@ public:
 
     [[nodiscard]] auto cppModule(const std::string &name) const -> Module *
     {
-        std::unordered_map<std::string, Module *>::const_iterator it = mModuleIndex.find(name);
+        std::unordered_map<std::uint32_t, Module *>::const_iterator it = mModuleIndex.find(mStrings.find(name));
 
         if (it != mModuleIndex.end())
         {
@@ -153,7 +142,7 @@ public:
 
     [[nodiscard]] auto project(const std::string &name) const -> Project *
     {
-        std::unordered_map<std::string, Project *>::const_iterator it = mProjectIndex.find(name);
+        std::unordered_map<std::uint32_t, Project *>::const_iterator it = mProjectIndex.find(mStrings.find(name));
 
         if (it != mProjectIndex.end())
         {
@@ -165,59 +154,261 @@ public:
         }
     }
 
-    [[nodiscard]] auto source(const std::filesystem::path &file, const std::filesystem::path &hint) const -> Source *
+    [[nodiscard]] auto source(std::string_view file, const std::filesystem::path &hint) const -> Source *
+    {
+        return find(file, hintedDirectory(file, hint), mSourceIndex);
+    }
+
+    [[nodiscard]] auto source(std::string_view file, const File *includer) const -> Source *
+    {
+        return find(file, hintedDirectory(file, includer), mSourceIndex);
+    }
+
+private:
+    struct Directory
+    {
+        std::uint32_t parent = 0;
+        std::uint32_t name = 0;
+    };
+
+    struct FileKey
+    {
+        std::uint32_t directory = 0;
+        std::uint32_t name = 0;
+    };
+
+    template<typename T>
+    struct FileIndex
+    {
+        std::unordered_map<std::uint64_t, T *> paths;
+        SuffixTrie<T, FileKey> suffixes;
+    };
+
+    template<typename T>
+    auto addFile(T *file, FileIndex<T> *index) -> void
+    {
+        const std::string path = file->path().string();
+        const std::size_t separator = path.find_last_of(SEPARATORS);
+        const std::string_view value = path;
+        const std::uint32_t directory = separator == std::string::npos ? 0 : internDirectory(value.substr(0, separator == 0 ? 1 : separator));
+        const std::uint32_t name = mStrings.intern(separator == std::string::npos ? value : value.substr(separator + 1));
+        mFileDirectories[file] = directory;
+        index->paths.insert({key(directory, name), file});
+        index->suffixes.insert(file, FileKey{.directory = directory, .name = name}, component());
+    }
+
+    [[nodiscard]] auto component() const
+    {
+        return [this](const FileKey &file, std::size_t depth) -> std::optional<std::uint32_t> {
+            if (depth == 0)
+            {
+                return file.name;
+            }
+
+            std::uint32_t directory = file.directory;
+
+            for (std::size_t i = 1; i < depth && directory != 0; ++i)
+            {
+                directory = mDirectories[directory].parent;
+            }
+
+            if (directory == 0)
+            {
+                return std::nullopt;
+            }
+
+            return mDirectories[directory].name;
+        };
+    }
+
+    [[nodiscard]] auto child(std::uint32_t directory, std::uint32_t name) const -> std::uint32_t
+    {
+        std::unordered_map<std::uint64_t, std::uint32_t>::const_iterator it = mChildDirectories.find(key(directory, name));
+
+        if (it != mChildDirectories.end())
+        {
+            return it->second;
+        }
+        else
+        {
+            return NO_DIRECTORY;
+        }
+    }
+
+    template<typename T>
+    [[nodiscard]] auto find(std::string_view file, std::uint32_t hintedDirectory, const FileIndex<T> &index) const -> T *
     {
-        using It = std::unordered_multimap<std::string, Source *>::const_iterator;
-        std::pair<It, It> range = mSourceIndex.equal_range(file.filename().string());
+        const std::size_t separator = file.find_last_of(SEPARATORS);
+        const std::uint32_t name = mStrings.find(separator == std::string_view::npos ? file : file.substr(separator + 1));
+
+        if (name == 0)
+        {
+            return nullptr;
+        }
 
-        if (!hint.empty())
+        if (hintedDirectory != NO_DIRECTORY)
         {
-            const std::filesystem::path hintedPath = (hint / file).lexically_normal();
+            typename std::unordered_map<std::uint64_t, T *>::const_iterator it = index.paths.find(key(hintedDirectory, name));
+
+            if (it != index.paths.end())
+            {
+                return it->second;
+            }
+        }
+
+        std::string_view directory = separator == std::string_view::npos ? std::string_view{} : file.substr(0, separator == 0 ? 1 : separator);
+        bool named = false;
 
-            for (It it = range.first; it != range.second; ++it)
+        const auto query = [&]() -> std::optional<std::uint32_t> {
+            if (!named)
             {
-                if (it->second->path() == hintedPath)
+                named = true;
+                return name;
+            }
+
+            while (!directory.empty())
+            {
+                const std::string_view part = popBackComponent(&directory);
+
+                if (!part.empty())
                 {
-                    return it->second;
+                    return mStrings.find(part);
                 }
             }
+
+            return std::nullopt;
+        };
+
+        return index.suffixes.find(query, component());
+    }
+
+    [[nodiscard]] auto hintedDirectory(std::string_view file, const std::filesystem::path &hint) const -> std::uint32_t
+    {
+        if (hint.empty())
+        {
+            return NO_DIRECTORY;
+        }
+
+        const std::string path = (hint / file).lexically_normal().parent_path().string();
+        std::uint32_t directory = 0;
+
+        for (std::string_view rest = path; !rest.empty() && directory != NO_DIRECTORY;)
+        {
+            directory = child(directory, mStrings.find(popFrontComponent(&rest)));
+        }
+
+        return directory;
+    }
+
+    [[nodiscard]] auto hintedDirectory(std::string_view file, const File *includer) const -> std::uint32_t
+    {
+        std::unordered_map<const File *, std::uint32_t>::const_iterator it = mFileDirectories.find(includer);
+
+        if (it == mFileDirectories.end())
+        {
+            return NO_DIRECTORY;
         }
 
-        for (It it = range.first; it != range.second; ++it)
+        std::uint32_t directory = file.starts_with('/') ? 0 : it->second;
+        const std::size_t separator = file.find_last_of(SEPARATORS);
+
+        for (std::string_view rest = separator == std::string_view::npos ? std::string_view{} : file.substr(0, separator == 0 ? 1 : separator); !rest.empty() && directory != NO_DIRECTORY;)
         {
-            if (isSame(it->second->path(), file))
+            const std::string_view component = popFrontComponent(&rest);
+
+            if (component == "..")
             {
-                return it->second;
+                if (mDirectories[directory].parent != 0)
+                {
+                    directory = mDirectories[directory].parent;
+                }
+            }
+            else if (component != ".")
+            {
+                directory = child(directory, mStrings.find(component));
             }
         }
 
-        return nullptr;
+        return directory;
     }
 
-private:
-    [[nodiscard]] static auto isSame(std::filesystem::path left, std::filesystem::path right) -> bool
+    [[nodiscard]] auto internDirectory(std::string_view path) -> std::uint32_t
     {
-        while (right.has_parent_path())
+        if (path == mLastDirectory)
         {
-            left = left.parent_path();
-            right = right.parent_path();
+            return mLastDirectoryId;
+        }
+
+        std::uint32_t directory = 0;
+
+        for (std::string_view rest = path; !rest.empty();)
+        {
+            const std::uint32_t name = mStrings.intern(popFrontComponent(&rest));
+            const std::pair<std::unordered_map<std::uint64_t, std::uint32_t>::iterator, bool> result = mChildDirectories.insert({key(directory, name), static_cast<std::uint32_t>(mDirectories.size())});
 
-            if (left.filename() != right.filename())
+            if (result.second)
             {
-                return false;
+                mDirectories.push_back(Directory{.parent = directory, .name = name});
             }
+
+            directory = result.first->second;
         }
 
-        return true;
+        mLastDirectory = path;
+        mLastDirectoryId = directory;
+        return directory;
     }
 
-    std::unordered_map<std::string, Project *> mProjectIndex;
-    std::unordered_map<std::string, Module *> mModuleIndex;
-    std::unordered_multimap<std::string, Source *> mSourceIndex;
-    std::unordered_multimap<std::string, Header *> mHeaderIndex;
+    [[nodiscard]] static auto key(std::uint32_t directory, std::uint32_t name) noexcept -> std::uint64_t
+    {
+        return (static_cast<std::uint64_t>(directory) << 32) | name;
+    }
+
+    [[nodiscard]] static auto popBackComponent(std::string_view *path) -> std::string_view
+    {
+        const std::size_t separator = path->find_last_of(SEPARATORS);
+
+        if (separator == std::string_view::npos || path->size() == 1)
+        {
+            const std::string_view component = *path;
+            *path = {};
+            return component;
+        }
+
+        const std::string_view component = path->substr(separator + 1);
+        *path = path->substr(0, separator == 0 ? 1 : separator);
+        return component;
+    }
+
+    [[nodiscard]] static auto popFrontComponent(std::string_view *path) -> std::string_view
+    {
+        const std::size_t separator = path->find_first_of(SEPARATORS);
+        const std::string_view component = path->substr(0, separator == 0 ? 1 : separator);
+        const std::size_t next = separator == std::string_view::npos ? std::string_view::npos : path->find_first_not_of(SEPARATORS, separator);
+        *path = next == std::string_view::npos ? std::string_view{} : path->substr(next);
+        return component;
+    }
+
+    static constexpr std::uint32_t NO_DIRECTORY = std::numeric_limits<std::uint32_t>::max();
+#ifdef _MSC_VER
+    static constexpr std::string_view SEPARATORS = "/\\";
+#else
+    static constexpr std::string_view SEPARATORS = "/";
+#endif
+
+    StringInterner mStrings;
+    std::vector<Directory> mDirectories{Directory{}};
+    std::unordered_map<std::uint64_t, std::uint32_t> mChildDirectories;
+    std::string mLastDirectory;
+    std::uint32_t mLastDirectoryId = 0;
+    std::unordered_map<const File *, std::uint32_t> mFileDirectories;
+    std::unordered_map<std::uint32_t, Project *> mProjectIndex;
+    std::unordered_map<std::uint32_t, Module *> mModuleIndex;
+    FileIndex<Source> mSourceIndex;
+    FileIndex<Header> mHeaderIndex;
     std::unordered_map<const File *, Module *> mModuleFileIndex;
     std::unordered_map<const File *, ModulePartition *> mModulePartitionsFileIndex;
     std::unordered_map<const void *, BuildTask *> mBuildTaskIndex;
-    std::unordered_map<std::string, BuildTask *> mBuildTaskNameIndex;
+    std::unordered_map<std::uint32_t, BuildTask *> mBuildTaskNameIndex;
 };
 }
@@ -0,0 +1,601 @@
+#ifdef _MSC_VER
+export module abuild : build_executor;
+export import : command_builder;
+import : artifact_store;
+import : build_scheduler;
+import : file_status_windows;
+import : file_view;
+import : fingerprint;
+import : thread_pool;
+import : tokenizer;
+import acore;
+#endif
+
+namespace abuild
+{
+export class BuildExecutor
+{
+public:
+    BuildExecutor(BuildCache &cache, const Toolchain &toolchain) :
+        BuildExecutor{cache, toolchain, std::thread::hardware_concurrency()}
+    {
+    }
+
+    BuildExecutor(BuildCache &cache, const Toolchain &toolchain, std::size_t threads) :
+        BuildExecutor{cache, toolchain, threads, SchedulingPolicy::ModulesFirst}
+    {
+    }
+
+    BuildExecutor(BuildCache &cache, const Toolchain &toolchain, std::size_t threads, SchedulingPolicy policy) :
+        mBuildCache{cache},
+        mCommandBuilder{cache, toolchain},
+        mGraph{cache},
+        mRemainingInputs(mGraph.size()),
+        mPriorities(mGraph.size()),
+        mDurations(mGraph.size()),
+        mOutputHashes(mGraph.size()),
+        mInterfaceHashes(mGraph.size()),
+        mRebuilt(mGraph.size()),
+        mStates(mGraph.size()),
+        mToolchainFingerprint{toolchainFingerprint(toolchain)},
+        mThreadPool{threads}
+    {
+        if (!cache.settings().storeDirectory().empty())
+        {
+            mStore.emplace(cache.projectRoot() / cache.settings().storeDirectory(), cache.settings().storeSizeLimit());
+        }
+
+        if (sortTasks())
+        {
+            computePriorities(policy);
+            execute();
+        }
+    }
+
+    [[nodiscard]] auto cutOffTasks() const noexcept -> std::size_t
+    {
+        return mCutOffTasks;
+    }
+
+    [[nodiscard]] auto executedTasks() const noexcept -> std::size_t
+    {
+        return mExecutedTasks;
+    }
+
+    [[nodiscard]] auto failedTasks() const noexcept -> std::size_t
+    {
+        return mFailedTasks;
+    }
+
+    [[nodiscard]] auto fetchedTasks() const noexcept -> std::size_t
+    {
+        return mFetchedTasks;
+    }
+
+    [[nodiscard]] auto upToDateTasks() const noexcept -> std::size_t
+    {
+        return mUpToDateTasks;
+    }
+
+private:
+    static auto addFileClosure(File *file, Fingerprint *fingerprint, std::unordered_set<const File *> *visited) -> void
+    {
+        if (!visited->insert(file).second)
+        {
+            return;
+        }
+
+        fingerprint->add(file->path().generic_string()).add(file->contentHash() != Digest{} ? file->contentHash() : file->view().hash());
+
+        for (const Dependency &dependency : file->dependencies())
+        {
+            std::visit([&](auto &&value) { fingerprint->add(value.name); }, dependency);
+
+            if (auto *dep = std::get_if<IncludeExternalHeaderDependency>(&dependency))
+            {
+                if (dep->header)
+                {
+                    addFileClosure(dep->header, fingerprint, visited);
+                }
+            }
+
+            if (auto *dep = std::get_if<IncludeLocalHeaderDependency>(&dependency))
+            {
+                if (dep->header)
+                {
+                    addFileClosure(dep->header, fingerprint, visited);
+                }
+            }
+
+            if (auto *dep = std::get_if<IncludeExternalSourceDependency>(&dependency))
+            {
+                if (dep->source)
+                {
+                    addFileClosure(dep->source, fingerprint, visited);
+                }
+            }
+
+            if (auto *dep = std::get_if<IncludeLocalSourceDependency>(&dependency))
+            {
+                if (dep->source)
+                {
+                    addFileClosure(dep->source, fingerprint, visited);
+                }
+            }
+        }
+    }
+
+    auto addInputs(std::uint32_t task, Fingerprint *fingerprint) const -> void
+    {
+        std::vector<Digest> inputs;
+
+        for (std::uint32_t input : mGraph.inputs(task))
+        {
+            inputs.push_back(isCompileTask(*mGraph.task(task)) ? mInterfaceHashes[input] : mOutputHashes[input]);
+        }
+
+        std::sort(inputs.begin(), inputs.end());
+
+        for (const Digest &input : inputs)
+        {
+            fingerprint->add(input);
+        }
+    }
+
+    auto addSystemHeaderClosure(const std::filesystem::path &header, Fingerprint *fingerprint, std::unordered_set<std::filesystem::path, PathHash> *visited) const -> void
+    {
+        if (!visited->insert(header).second)
+        {
+            return;
+        }
+
+        const FileView view{header};
+        fingerprint->add(header.generic_string()).add(view.hash());
+        Tokenizer tokenizer{view.content()};
+
+        for (Token token = tokenizer.next(); !std::holds_alternative<std::monostate>(token); token = tokenizer.next())
+        {
+            std::optional<std::filesystem::path> include;
+
+            if (auto *value = std::get_if<IncludeExternalToken>(&token))
+            {
+                include = mCommandBuilder.systemHeader(value->name);
+            }
+            else if (auto *value = std::get_if<IncludeLocalToken>(&token))
+            {
+                std::error_code error;
+                const std::filesystem::path local = header.parent_path() / value->name;
+                include = std::filesystem::is_regular_file(local, error) ? local.lexically_normal() : mCommandBuilder.systemHeader(value->name);
+            }
+
+            if (include)
+            {
+                addSystemHeaderClosure(*include, fingerprint, visited);
+            }
+        }
+    }
+
+    [[nodiscard]] static auto commandLine(const Command &command) -> std::string
+    {
+        std::string line = command.executable.string();
+
+        for (const std::string &argument : command.arguments)
+        {
+            line += ' ' + argument;
+        }
+
+        return line;
+    }
+
+    auto complete(std::uint32_t task) -> void
+    {
+        mExecutedTasks++;
+
+        for (std::uint32_t dependent : mGraph.dependents(task))
+        {
+            if (--mRemainingInputs[dependent] == 0)
+            {
+                schedule(dependent);
+            }
+        }
+    }
+
+    auto computePriorities(SchedulingPolicy policy) -> void
+    {
+        const BuildReport report{mBuildCache, mGraph};
+        const BuildSchedule schedule{mGraph, report, policy};
+
+        for (std::uint32_t task = 0; task < mGraph.size(); ++task)
+        {
+            mPriorities[task] = schedule.priority(task);
+        }
+    }
+
+    auto execute() -> void
+    {
+        const TraceSpan span{mBuildCache.trace(), "BuildExecutor", "BuildExecutor"};
+        std::filesystem::create_directories(mCommandBuilder.buildRoot());
+        mCommandBuilder.writeModuleMapper();
+
+        for (std::uint32_t task : mOrder)
+        {
+            if (mGraph.inputs(task).empty())
+            {
+                schedule(task);
+            }
+        }
+
+        mThreadPool.wait();
+
+        for (std::uint32_t task = 0; task < mGraph.size(); ++task)
+        {
+            if (mDurations[task])
+            {
+                mBuildCache.setTaskDuration(*mGraph.task(task), *mDurations[task]);
+            }
+
+            if (mStates[task])
+            {
+                mBuildCache.setTaskState(*mGraph.task(task), std::move(*mStates[task]));
+            }
+        }
+
+        for (Error &error : mErrors)
+        {
+            mBuildCache.addError(std::move(error));
+        }
+    }
+
+    auto fail(std::string what) -> void
+    {
+        std::scoped_lock lock{mErrorsMutex};
+        mFailedTasks++;
+        mErrors.push_back(Error{.component = COMPONENT, .what = std::move(what)});
+    }
+
+    [[nodiscard]] auto hasSystemClosure(Header *header) const -> bool
+    {
+        for (const Dependency &dependency : header->dependencies())
+        {
+            if (std::holds_alternative<IncludeSTLHeaderDependency>(dependency) || std::holds_alternative<ImportSTLHeaderDependency>(dependency))
+            {
+                continue;
+            }
+
+            const auto *dep = std::get_if<IncludeExternalHeaderDependency>(&dependency);
+
+            if (!dep || dep->header || !mCommandBuilder.systemHeader(dep->name))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] static auto isCompileTask(const BuildTask &task) noexcept -> bool
+    {
+        return std::holds_alternative<CompileHeaderUnitTask>(task)
+            || std::holds_alternative<CompileSTLHeaderUnitTask>(task)
+            || std::holds_alternative<CompileModuleInterfaceTask>(task)
+            || std::holds_alternative<CompileModulePartitionTask>(task)
+            || std::holds_alternative<CompileSourceTask>(task);
+    }
+
+    [[nodiscard]] static auto isUpToDate(const TaskState *state, const Digest &fingerprint, const std::vector<std::filesystem::path> &outputs) -> bool
+    {
+        if (state == nullptr || state->fingerprint != fingerprint)
+        {
+            return false;
+        }
+
+        const std::optional<std::vector<FileStatus>> statuses = outputStatuses(outputs);
+        return statuses && *statuses == state->outputs;
+    }
+
+    [[nodiscard]] static auto outputHash(const std::vector<std::filesystem::path> &outputs) -> Digest
+    {
+        Fingerprint fingerprint;
+
+        for (const std::filesystem::path &output : outputs)
+        {
+            fingerprint.add(FileView{output}.hash());
+        }
+
+        return fingerprint.value();
+    }
+
+    [[nodiscard]] static auto outputStatuses(const std::vector<std::filesystem::path> &outputs) -> std::optional<std::vector<FileStatus>>
+    {
+        std::vector<FileStatus> statuses;
+        std::error_code error;
+
+        for (const std::filesystem::path &output : outputs)
+        {
+            if (!std::filesystem::is_regular_file(output, error))
+            {
+                return std::nullopt;
+            }
+
+            statuses.push_back(fileStatus(output));
+        }
+
+        return statuses;
+    }
+
+    auto record(std::uint32_t task, const Digest &fingerprint, const std::vector<std::filesystem::path> &outputs) -> void
+    {
+        const std::optional<std::filesystem::path> bmi = mCommandBuilder.bmi(*mGraph.task(task));
+        mOutputHashes[task] = outputHash(outputs);
+        mInterfaceHashes[task] = bmi ? outputHash({*bmi}) : Digest{};
+        mRebuilt[task] = 1;
+        std::optional<std::vector<FileStatus>> statuses = outputStatuses(outputs);
+
+        if (statuses)
+        {
+            mStates[task] = TaskState{.fingerprint = fingerprint, .outputHash = mOutputHashes[task], .interfaceHash = mInterfaceHashes[task], .outputs = std::move(*statuses)};
+        }
+    }
+
+    auto run(std::uint32_t task) -> void
+    {
+        try
+        {
+            const BuildTask &buildTask = *mGraph.task(task);
+            const TraceSpan span{mBuildCache.trace(), "BuildExecutor", [&] { return mBuildCache.taskName(buildTask); }};
+            const Fingerprint fingerprint = taskFingerprint(task);
+            const std::vector<std::filesystem::path> outputs = mCommandBuilder.outputs(buildTask);
+            const TaskState *state = mBuildCache.taskState(buildTask);
+
+            if (isUpToDate(state, fingerprint.value(), outputs))
+            {
+                mUpToDateTasks++;
+                mOutputHashes[task] = state->outputHash;
+                mInterfaceHashes[task] = state->interfaceHash;
+
+                if (std::any_of(mGraph.inputs(task).begin(), mGraph.inputs(task).end(), [&](std::uint32_t input) { return mRebuilt[input] != 0; }))
+                {
+                    mCutOffTasks++;
+                }
+
+                complete(task);
+                return;
+            }
+
+            const bool cached = mStore && isCompileTask(buildTask);
+
+            const std::string key = cached ? storeKey(task, fingerprint) : std::string{};
+
+            if (cached && mStore->fetch(key, outputs))
+            {
+                mFetchedTasks++;
+                record(task, fingerprint.value(), outputs);
+                complete(task);
+                return;
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+
+            if (runCommands(buildTask))
+            {
+                mDurations[task] = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+                if (cached)
+                {
+                    mStore->store(key, outputs);
+                }
+
+                record(task, fingerprint.value(), outputs);
+                complete(task);
+            }
+        }
+        catch (std::exception &e)
+        {
+            fail(e.what());
+        }
+    }
+
+    [[nodiscard]] auto runCommands(const BuildTask &task) -> bool
+    {
+        for (const std::filesystem::path &output : mCommandBuilder.outputs(task))
+        {
+            std::filesystem::create_directories(output.parent_path());
+        }
+
+        for (const Command &command : mCommandBuilder.commands(task))
+        {
+            const acore::Process process{command.executable.string(), command.arguments, mCommandBuilder.buildRoot().string()};
+
+            if (process.exitCode() != 0)
+            {
+                fail(commandLine(command) + '\n' + process.output());
+                return false;
+            }
+        }
+
+        std::error_code error;
+
+        for (const std::filesystem::path &output : mCommandBuilder.outputs(task))
+        {
+            if (!std::filesystem::is_regular_file(output, error))
+            {
+                fail(mBuildCache.taskName(task) + ": output '" + output.string() + "' was not produced.");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    auto schedule(std::uint32_t task) -> void
+    {
+        mThreadPool.run([this, task] { run(task); }, mPriorities[task]);
+    }
+
+    [[nodiscard]] auto sortTasks() -> bool
+    {
+        std::vector<std::size_t> remainingInputs;
+        remainingInputs.reserve(mGraph.size());
+        mOrder.reserve(mGraph.size());
+
+        for (std::uint32_t task = 0; task < mGraph.size(); ++task)
+        {
+            remainingInputs.push_back(mGraph.inputs(task).size());
+            mRemainingInputs[task] = remainingInputs.back();
+
+            if (remainingInputs.back() == 0)
+            {
+                mOrder.push_back(task);
+            }
+        }
+
+        for (std::size_t i = 0; i < mOrder.size(); ++i)
+        {
+            for (std::uint32_t dependent : mGraph.dependents(mOrder[i]))
+            {
+                if (--remainingInputs[dependent] == 0)
+                {
+                    mOrder.push_back(dependent);
+                }
+            }
+        }
+
+        if (mOrder.size() != mGraph.size())
+        {
+            mBuildCache.addError(Error{.component = COMPONENT, .what = "Cyclic dependency between build tasks detected. Nothing will be built."});
+            return false;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] auto storeKey(std::uint32_t task, const Fingerprint &fingerprint) const -> std::string
+    {
+        const auto *headerUnit = std::get_if<CompileHeaderUnitTask>(mGraph.task(task));
+
+        if (!headerUnit || !hasSystemClosure(headerUnit->header))
+        {
+            return fingerprint.hex();
+        }
+
+        Fingerprint key = mToolchainFingerprint;
+        std::unordered_set<std::filesystem::path, PathHash> visited;
+        Header *header = headerUnit->header;
+        key.add(static_cast<std::uint64_t>(mGraph.task(task)->index()));
+        key.add(header->path().lexically_relative(mBuildCache.projectRoot()).generic_string());
+        key.add(header->contentHash() != Digest{} ? header->contentHash() : header->view().hash());
+
+        for (const Dependency &dependency : header->dependencies())
+        {
+            const std::string &name = std::visit([](auto &&value) -> const std::string & { return value.name; }, dependency);
+            key.add(name);
+
+            if (std::holds_alternative<ImportSTLHeaderDependency>(dependency))
+            {
+                continue;
+            }
+
+            if (const std::optional<std::filesystem::path> include = mCommandBuilder.systemHeader(name))
+            {
+                addSystemHeaderClosure(*include, &key, &visited);
+            }
+        }
+
+        addInputs(task, &key);
+        return key.hex();
+    }
+
+    [[nodiscard]] auto taskFingerprint(std::uint32_t task) const -> Fingerprint
+    {
+        const BuildTask &buildTask = *mGraph.task(task);
+        Fingerprint fingerprint = mToolchainFingerprint;
+        fingerprint.add(static_cast<std::uint64_t>(buildTask.index()));
+
+        if (const auto *stlHeaderUnit = std::get_if<CompileSTLHeaderUnitTask>(&buildTask))
+        {
+            fingerprint.add(stlHeaderUnit->name);
+            std::unordered_set<std::filesystem::path, PathHash> visited;
+
+            if (const std::optional<std::filesystem::path> header = mCommandBuilder.systemHeader(stlHeaderUnit->name))
+            {
+                addSystemHeaderClosure(*header, &fingerprint, &visited);
+            }
+
+            return fingerprint;
+        }
+
+        for (const Command &command : mCommandBuilder.commands(buildTask))
+        {
+            fingerprint.add(command.executable.generic_string());
+
+            for (const std::string &argument : command.arguments)
+            {
+                fingerprint.add(argument);
+            }
+        }
+
+        addInputs(task, &fingerprint);
+        std::unordered_set<const File *> visited;
+
+        if (const auto *headerUnit = std::get_if<CompileHeaderUnitTask>(&buildTask))
+        {
+            addFileClosure(headerUnit->header, &fingerprint, &visited);
+        }
+        else if (const auto *moduleInterface = std::get_if<CompileModuleInterfaceTask>(&buildTask))
+        {
+            addFileClosure(moduleInterface->source, &fingerprint, &visited);
+        }
+        else if (const auto *modulePartition = std::get_if<CompileModulePartitionTask>(&buildTask))
+        {
+            addFileClosure(modulePartition->source, &fingerprint, &visited);
+        }
+        else if (const auto *source = std::get_if<CompileSourceTask>(&buildTask))
+        {
+            addFileClosure(source->source, &fingerprint, &visited);
+        }
+
+        return fingerprint;
+    }
+
+    [[nodiscard]] static auto toolchainFingerprint(const Toolchain &toolchain) -> Fingerprint
+    {
+        Fingerprint fingerprint;
+        std::error_code error;
+        fingerprint.add(static_cast<std::uint64_t>(toolchain.type)).add(toolchain.compiler.generic_string());
+        fingerprint.add(static_cast<std::uint64_t>(std::filesystem::last_write_time(toolchain.compiler, error).time_since_epoch().count()));
+        fingerprint.add(static_cast<std::uint64_t>(std::filesystem::file_size(toolchain.compiler, error)));
+        std::vector<std::string> flags{toolchain.compilerFlags.begin(), toolchain.compilerFlags.end()};
+        std::sort(flags.begin(), flags.end());
+
+        for (const std::string &flag : flags)
+        {
+            fingerprint.add(flag);
+        }
+
+        return fingerprint;
+    }
+
+    BuildCache &mBuildCache;
+    CommandBuilder mCommandBuilder;
+    CompactBuildGraph mGraph;
+    std::vector<std::atomic<std::size_t>> mRemainingInputs;
+    std::vector<std::int64_t> mPriorities;
+    std::vector<std::optional<std::chrono::milliseconds>> mDurations;
+    std::vector<Digest> mOutputHashes;
+    std::vector<Digest> mInterfaceHashes;
+    std::vector<std::uint8_t> mRebuilt;
+    std::vector<std::optional<TaskState>> mStates;
+    Fingerprint mToolchainFingerprint;
+    std::optional<ArtifactStore> mStore;
+    std::vector<std::uint32_t> mOrder;
+    std::mutex mErrorsMutex;
+    std::vector<Error> mErrors;
+    std::atomic<std::size_t> mExecutedTasks = 0;
+    std::atomic<std::size_t> mCutOffTasks = 0;
+    std::atomic<std::size_t> mFetchedTasks = 0;
+    std::atomic<std::size_t> mUpToDateTasks = 0;
+    std::size_t mFailedTasks = 0;
+    ThreadPool mThreadPool;
+    static constexpr char COMPONENT[] = "BuildExecutor";
+};
+}
@@ -12,95 +12,230 @@ public:
     explicit BuildGraph(BuildCache &cache) :
         mBuildCache{cache}
     {
+        const TraceSpan span{mBuildCache.trace(), "BuildGraph", "BuildGraph"};
         createLinkTasks();
         createCompileTasks();
     }
 
+    BuildGraph(BuildCache &cache, const std::vector<Header *> &headerUnits) :
+        mBuildCache{cache},
+        mLinkTasks{false}
+    {
+        const TraceSpan span{mBuildCache.trace(), "BuildGraph", "BuildGraph"};
+
+        for (Header *header : headerUnits)
+        {
+            createCompileHeaderUnitTask(header);
+        }
+    }
+
 private:
-    auto addDependency(CompileTask *compileTask, BuildTask *linkTask, const Dependency &dependency, File *base, std::unordered_set<File *> &includes) -> void
+    using ClosureEntry = std::variant<std::filesystem::path, Project *, Header *, Module *, ModulePartition *, std::string>;
+
+    struct ClosureNode
+    {
+        File *file = nullptr;
+        std::uint32_t lowLink = 0;
+        std::size_t next = 0;
+        std::vector<File *> includes;
+        std::vector<std::uint32_t> entries;
+        std::vector<std::uint32_t> closures;
+    };
+
+    auto addClosureDependency(ClosureNode *node, const Dependency &dependency, const std::filesystem::path &base) -> void
     {
         if (auto *dep = std::get_if<IncludeExternalHeaderDependency>(&dependency))
         {
-            if (dep->header && !includes.contains(dep->header))
+            if (dep->header)
             {
-                includes.insert(dep->header);
-                addIncludePath(compileTask, base->path().parent_path(), includePath(dep->header->path(), dep->name));
-                addDependencies(compileTask, linkTask, dep->header->dependencies(), dep->header, includes);
-                addInput(linkTask, mBuildCache.buildTask(dep->header->project()));
+                addClosureInclude(node, dep->header, dep->name, base);
+                node->entries.push_back(closureEntry(mEntityEntries, dep->header->project(), dep->header->project()));
             }
             return;
         }
 
         if (auto *dep = std::get_if<IncludeLocalHeaderDependency>(&dependency))
         {
-            if (dep->header && !includes.contains(dep->header))
+            if (dep->header)
             {
-                includes.insert(dep->header);
-                addIncludePath(compileTask, base->path().parent_path(), includePath(dep->header->path(), dep->name));
-                addDependencies(compileTask, linkTask, dep->header->dependencies(), dep->header, includes);
-                addInput(linkTask, mBuildCache.buildTask(dep->header->project()));
+                addClosureInclude(node, dep->header, dep->name, base);
+                node->entries.push_back(closureEntry(mEntityEntries, dep->header->project(), dep->header->project()));
             }
             return;
         }
 
         if (auto *dep = std::get_if<IncludeLocalSourceDependency>(&dependency))
         {
-            if (dep->source && !includes.contains(dep->source))
+            if (dep->source)
             {
-                includes.insert(dep->source);
-                addIncludePath(compileTask, base->path().parent_path(), includePath(dep->source->path(), dep->name));
-                addDependencies(compileTask, linkTask, dep->source->dependencies(), dep->source, includes);
+                addClosureInclude(node, dep->source, dep->name, base);
             }
             return;
         }
 
         if (auto *dep = std::get_if<IncludeExternalSourceDependency>(&dependency))
         {
-            if (dep->source && !includes.contains(dep->source))
+            if (dep->source)
             {
-                includes.insert(dep->source);
-                addIncludePath(compileTask, base->path().parent_path(), includePath(dep->source->path(), dep->name));
-                addDependencies(compileTask, linkTask, dep->source->dependencies(), dep->source, includes);
+                addClosureInclude(node, dep->source, dep->name, base);
             }
             return;
         }
 
         if (auto *dep = std::get_if<ImportExternalHeaderDependency>(&dependency))
         {
-            addImportHeaderDependency(compileTask, linkTask, dep->header);
+            if (dep->header)
+            {
+                node->entries.push_back(closureEntry(mEntityEntries, dep->header, dep->header));
+            }
             return;
         }
 
         if (auto *dep = std::get_if<ImportLocalHeaderDependency>(&dependency))
         {
-            addImportHeaderDependency(compileTask, linkTask, dep->header);
+            if (dep->header)
+            {
+                node->entries.push_back(closureEntry(mEntityEntries, dep->header, dep->header));
+            }
             return;
         }
 
         if (auto *dep = std::get_if<ImportModuleDependency>(&dependency))
         {
-            addImportModuleDependency(compileTask, linkTask, dep->mod);
+            if (dep->mod && dep->mod->source)
+            {
+                node->entries.push_back(closureEntry(mEntityEntries, dep->mod, dep->mod));
+            }
             return;
         }
 
         if (auto *dep = std::get_if<ImportModulePartitionDependency>(&dependency))
         {
-            addImportModulePartitionDependency(compileTask, linkTask, dep->partition);
+            if (dep->partition && dep->partition->source)
+            {
+                node->entries.push_back(closureEntry(mEntityEntries, dep->partition, dep->partition));
+            }
             return;
         }
 
         if (auto *dep = std::get_if<ImportSTLHeaderDependency>(&dependency))
         {
-            compileTask->inputTasks.insert(createCompileSTLHeaderUnitTask(dep->name));
+            node->entries.push_back(closureEntry(mSTLHeaderEntries, dep->name, dep->name));
+            return;
+        }
+    }
+
+    auto addClosureEntry(CompileTask *compileTask, BuildTask *linkTask, const ClosureEntry &entry) -> void
+    {
+        if (auto *path = std::get_if<std::filesystem::path>(&entry))
+        {
+            compileTask->includePaths.insert(*path);
+            return;
+        }
+
+        if (auto *project = std::get_if<Project *>(&entry))
+        {
+            addInput(linkTask, mBuildCache.buildTask(*project));
+            return;
+        }
+
+        if (auto *header = std::get_if<Header *>(&entry))
+        {
+            addImportHeaderDependency(compileTask, linkTask, *header);
+            return;
+        }
+
+        if (auto *mod = std::get_if<Module *>(&entry))
+        {
+            addImportModuleDependency(compileTask, linkTask, *mod);
+            return;
+        }
+
+        if (auto *partition = std::get_if<ModulePartition *>(&entry))
+        {
+            addImportModulePartitionDependency(compileTask, linkTask, *partition);
+            return;
+        }
+
+        if (auto *name = std::get_if<std::string>(&entry))
+        {
+            compileTask->inputTasks.insert(createCompileSTLHeaderUnitTask(*name));
             return;
         }
     }
 
-    auto addDependencies(CompileTask *compileTask, BuildTask *linkTask, const std::vector<Dependency> &dependencies, File *base, std::unordered_set<File *> &includes) -> void
+    auto addDependencies(CompileTask *compileTask, BuildTask *linkTask, File *file) -> void
     {
-        for (const Dependency &dependency : dependencies)
+        for (std::uint32_t entry : mClosures[closure(file)])
         {
-            addDependency(compileTask, linkTask, dependency, base, includes);
+            addClosureEntry(compileTask, linkTask, mClosureEntries[entry]);
+        }
+    }
+
+    auto addExportDependency(std::vector<std::uint32_t> *entries, const Dependency &dependency) -> void
+    {
+        if (auto *dep = std::get_if<ImportExternalHeaderDependency>(&dependency))
+        {
+            if (dep->header && dep->visibility == DependencyVisibility::Public)
+            {
+                entries->push_back(closureEntry(mEntityEntries, dep->header, dep->header));
+            }
+            return;
+        }
+
+        if (auto *dep = std::get_if<ImportLocalHeaderDependency>(&dependency))
+        {
+            if (dep->header && dep->visibility == DependencyVisibility::Public)
+            {
+                entries->push_back(closureEntry(mEntityEntries, dep->header, dep->header));
+            }
+            return;
+        }
+
+        if (auto *dep = std::get_if<ImportModuleDependency>(&dependency))
+        {
+            if (dep->mod && dep->mod->source && dep->visibility == DependencyVisibility::Public)
+            {
+                entries->push_back(closureEntry(mEntityEntries, dep->mod, dep->mod));
+            }
+            return;
+        }
+
+        if (auto *dep = std::get_if<ImportModulePartitionDependency>(&dependency))
+        {
+            if (dep->partition && dep->partition->source && dep->visibility == DependencyVisibility::Public)
+            {
+                entries->push_back(closureEntry(mEntityEntries, dep->partition, dep->partition));
+            }
+            return;
+        }
+
+        if (auto *dep = std::get_if<ImportSTLHeaderDependency>(&dependency))
+        {
+            if (dep->visibility == DependencyVisibility::Public)
+            {
+                entries->push_back(closureEntry(mSTLHeaderEntries, dep->name, dep->name));
+            }
+            return;
+        }
+    }
+
+    auto addExports(CompileTask *compileTask, BuildTask *linkTask, File *file) -> void
+    {
+        for (std::uint32_t entry : exports(file))
+        {
+            addClosureEntry(compileTask, linkTask, mClosureEntries[entry]);
+        }
+    }
+
+    auto addClosureInclude(ClosureNode *node, File *file, const std::string &name, const std::filesystem::path &base) -> void
+    {
+        const std::filesystem::path include = includePath(file->path(), name);
+        node->includes.push_back(file);
+
+        if (include != base)
+        {
+            node->entries.push_back(closureEntry(mIncludePathEntries, include.string(), include));
         }
     }
 
@@ -117,24 +252,20 @@ private:
     {
         if (mod && mod->source)
         {
-            compileTask->inputTasks.insert(createCompileModuleInterfaceTask(mod));
             addInput(linkTask, mBuildCache.buildTask(mod));
-        }
-    }
 
-    auto addImportModulePartitionDependency(CompileTask *compileTask, [[maybe_unused]] BuildTask *linkTask, ModulePartition *partition) -> void
-    {
-        if (partition && partition->source)
-        {
-            compileTask->inputTasks.insert(createCompileModulePartitionTask(partition));
+            if (compileTask->inputTasks.insert(createCompileModuleInterfaceTask(mod)).second)
+            {
+                addExports(compileTask, linkTask, mod->source);
+            }
         }
     }
 
-    auto addIncludePath(CompileTask *compileTask, const std::filesystem::path &base, const std::filesystem::path &include) -> void
+    auto addImportModulePartitionDependency(CompileTask *compileTask, BuildTask *linkTask, ModulePartition *partition) -> void
     {
-        if (include != base)
+        if (partition && partition->source && compileTask->inputTasks.insert(createCompileModulePartitionTask(partition)).second)
         {
-            compileTask->includePaths.insert(include);
+            addExports(compileTask, linkTask, partition->source);
         }
     }
 
@@ -162,6 +293,103 @@ private:
         return task;
     }
 
+    [[nodiscard]] auto closeComponent(std::uint32_t root, std::vector<ClosureNode> &nodes, std::vector<std::uint32_t> &component) -> std::uint32_t
+    {
+        const std::uint32_t id = static_cast<std::uint32_t>(mClosures.size());
+        std::vector<std::uint32_t> entries;
+        std::uint32_t member = 0;
+
+        do
+        {
+            member = component.back();
+            component.pop_back();
+            entries.insert(entries.end(), nodes[member].entries.begin(), nodes[member].entries.end());
+
+            for (std::uint32_t closure : nodes[member].closures)
+            {
+                entries.insert(entries.end(), mClosures[closure].begin(), mClosures[closure].end());
+            }
+
+            mClosureIds.insert({nodes[member].file, id});
+        } while (member != root);
+
+        std::sort(entries.begin(), entries.end());
+        entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+        mClosures.push_back(std::move(entries));
+        return id;
+    }
+
+    [[nodiscard]] auto closure(File *file) -> std::uint32_t
+    {
+        if (std::unordered_map<const File *, std::uint32_t>::const_iterator it = mClosureIds.find(file); it != mClosureIds.end())
+        {
+            return it->second;
+        }
+
+        std::vector<ClosureNode> nodes;
+        std::unordered_map<const File *, std::uint32_t> indices;
+        std::vector<std::uint32_t> component;
+        std::vector<std::uint32_t> path;
+
+        visitClosureNode(file, nodes, indices, component, path);
+
+        while (!path.empty())
+        {
+            const std::uint32_t current = path.back();
+
+            if (nodes[current].next < nodes[current].includes.size())
+            {
+                File *include = nodes[current].includes[nodes[current].next++];
+
+                if (std::unordered_map<const File *, std::uint32_t>::const_iterator it = mClosureIds.find(include); it != mClosureIds.end())
+                {
+                    nodes[current].closures.push_back(it->second);
+                }
+                else if (std::unordered_map<const File *, std::uint32_t>::const_iterator node = indices.find(include); node != indices.end())
+                {
+                    nodes[current].lowLink = std::min(nodes[current].lowLink, node->second);
+                }
+                else
+                {
+                    visitClosureNode(include, nodes, indices, component, path);
+                }
+            }
+            else
+            {
+                path.pop_back();
+
+                if (nodes[current].lowLink == current)
+                {
+                    const std::uint32_t id = closeComponent(current, nodes, component);
+
+                    if (!path.empty())
+                    {
+                        nodes[path.back()].closures.push_back(id);
+                    }
+                }
+                else
+                {
+                    nodes[path.back()].lowLink = std::min(nodes[path.back()].lowLink, nodes[current].lowLink);
+                }
+            }
+        }
+
+        return mClosureIds[file];
+    }
+
+    template<typename Key>
+    [[nodiscard]] auto closureEntry(std::unordered_map<Key, std::uint32_t> &ids, const std::type_identity_t<Key> &key, ClosureEntry entry) -> std::uint32_t
+    {
+        const std::pair<typename std::unordered_map<Key, std::uint32_t>::iterator, bool> result = ids.insert({key, static_cast<std::uint32_t>(mClosureEntries.size())});
+
+        if (result.second)
+        {
+            mClosureEntries.push_back(std::move(entry));
+        }
+
+        return result.first->second;
+    }
+
     [[nodiscard]] auto createCompileModuleInterfaceTask(Module *mod) -> BuildTask *
     {
         BuildTask *task = buildTask<CompileModuleInterfaceTask>(mod->source);
@@ -172,14 +400,13 @@ private:
             compileTask->source = mod->source;
             auto linkTask = mBuildCache.buildTask(mod);
             addInput(linkTask, task);
-            std::unordered_set<File *> includes;
-            addDependencies(compileTask, linkTask, mod->source->dependencies(), mod->source, includes);
+            addDependencies(compileTask, linkTask, mod->source);
         }
 
         return task;
     }
 
-    [[nodiscard]] auto createCompileHeaderUnitTask(Header *header) -> BuildTask *
+    auto createCompileHeaderUnitTask(Header *header) -> BuildTask *
     {
         BuildTask *task = buildTask<CompileHeaderUnitTask>(header);
         auto compileTask = &std::get<CompileHeaderUnitTask>(*task);
@@ -187,10 +414,9 @@ private:
         if (!compileTask->header)
         {
             compileTask->header = header;
-            auto linkTask = createHeaderLinkTask(header->project());
+            auto linkTask = mLinkTasks ? createHeaderLinkTask(header->project()) : nullptr;
             addInput(linkTask, task);
-            std::unordered_set<File *> includes;
-            addDependencies(compileTask, linkTask, header->dependencies(), header, includes);
+            addDependencies(compileTask, linkTask, header);
         }
 
         return task;
@@ -206,8 +432,7 @@ private:
             compileTask->source = partition->source;
             auto linkTask = mBuildCache.buildTask(partition->mod);
             addInput(linkTask, task);
-            std::unordered_set<File *> includes;
-            addDependencies(compileTask, linkTask, partition->source->dependencies(), partition->source, includes);
+            addDependencies(compileTask, linkTask, partition->source);
         }
 
         return task;
@@ -223,8 +448,7 @@ private:
             compileTask->source = source;
             auto linkTask = mBuildCache.buildTask(source->project());
             addInput(linkTask, task);
-            std::unordered_set<File *> includes;
-            addDependencies(compileTask, linkTask, source->dependencies(), source, includes);
+            addDependencies(compileTask, linkTask, source);
         }
 
         return task;
@@ -261,9 +485,9 @@ private:
 
     auto createCompileTasks() -> void
     {
-        for (const std::unique_ptr<Source> &source : mBuildCache.sources())
+        for (Source *source : mBuildCache.sources())
         {
-            createCompileTask(source.get());
+            createCompileTask(source);
         }
     }
 
@@ -301,17 +525,17 @@ private:
 
     auto createModuleLinkTasks() -> void
     {
-        for (const std::unique_ptr<Module> &mod : mBuildCache.modules())
+        for (Module *mod : mBuildCache.modules())
         {
-            createLinkTask(mod.get());
+            createLinkTask(mod);
         }
     }
 
     auto createProjectLinkTasks() -> void
     {
-        for (const std::unique_ptr<Project> &project : mBuildCache.projects())
+        for (Project *project : mBuildCache.projects())
         {
-            createLinkTask(project.get());
+            createLinkTask(project);
         }
     }
 
@@ -327,6 +551,21 @@ private:
         }
     }
 
+    [[nodiscard]] auto exports(File *file) -> const std::vector<std::uint32_t> &
+    {
+        const std::pair<std::unordered_map<const File *, std::vector<std::uint32_t>>::iterator, bool> result = mExports.insert({file, {}});
+
+        if (result.second)
+        {
+            for (const Dependency &dependency : file->dependencies())
+            {
+                addExportDependency(&result.first->second, dependency);
+            }
+        }
+
+        return result.first->second;
+    }
+
     [[nodiscard]] auto hasSources(const Project *project) -> bool
     {
         for (const Source *source : project->sources())
@@ -353,6 +592,31 @@ private:
         return file;
     }
 
+    auto visitClosureNode(File *file, std::vector<ClosureNode> &nodes, std::unordered_map<const File *, std::uint32_t> &indices, std::vector<std::uint32_t> &component, std::vector<std::uint32_t> &path) -> void
+    {
+        const std::uint32_t index = static_cast<std::uint32_t>(nodes.size());
+        ClosureNode node{.file = file, .lowLink = index};
+        const std::filesystem::path base = file->path().parent_path();
+
+        for (const Dependency &dependency : file->dependencies())
+        {
+            addClosureDependency(&node, dependency, base);
+        }
+
+        nodes.push_back(std::move(node));
+        indices.insert({file, index});
+        component.push_back(index);
+        path.push_back(index);
+    }
+
     BuildCache &mBuildCache;
+    std::deque<ClosureEntry> mClosureEntries;
+    std::deque<std::vector<std::uint32_t>> mClosures;
+    std::unordered_map<const File *, std::uint32_t> mClosureIds;
+    std::unordered_map<std::string, std::uint32_t> mIncludePathEntries;
+    std::unordered_map<const void *, std::uint32_t> mEntityEntries;
+    std::unordered_map<const File *, std::vector<std::uint32_t>> mExports;
+    std::unordered_map<std::string, std::uint32_t> mSTLHeaderEntries;
+    bool mLinkTasks = true;
 };
 }
@@ -0,0 +1,370 @@
+#ifdef _MSC_VER
+export module abuild : build_report;
+export import : compact_build_graph;
+import<rapidjson.hpp>;
+#endif
+
+namespace abuild
+{
+export struct ProjectReport
+{
+    std::string name;
+    std::size_t tasks = 0;
+    std::chrono::milliseconds work{0};
+    std::chrono::milliseconds criticalPath{0};
+};
+
+export class BuildReport
+{
+public:
+    BuildReport(const BuildCache &cache, const CompactBuildGraph &graph) :
+        mBuildCache{cache},
+        mGraph{graph},
+        mDurations(graph.size()),
+        mEstimated(graph.size(), false),
+        mRemainingDurations(graph.size())
+    {
+        estimateDurations();
+
+        if (sortTasks())
+        {
+            computeRemainingDurations();
+            collectCriticalPath();
+        }
+
+        collectProjects();
+    }
+
+    [[nodiscard]] auto criticalPath() const noexcept -> const std::vector<std::uint32_t> &
+    {
+        return mCriticalPath;
+    }
+
+    [[nodiscard]] auto criticalPathDuration() const noexcept -> std::chrono::milliseconds
+    {
+        return mCriticalPath.empty() ? std::chrono::milliseconds{0} : mRemainingDurations[mCriticalPath.front()];
+    }
+
+    [[nodiscard]] auto duration(std::uint32_t task) const noexcept -> std::chrono::milliseconds
+    {
+        return mDurations[task];
+    }
+
+    [[nodiscard]] auto estimated(std::uint32_t task) const noexcept -> bool
+    {
+        return mEstimated[task];
+    }
+
+    [[nodiscard]] auto estimatedTasks() const noexcept -> std::size_t
+    {
+        return mEstimatedTasks;
+    }
+
+    [[nodiscard]] auto json() const -> std::string
+    {
+        rapidjson::StringBuffer buffer;
+        rapidjson::PrettyWriter<rapidjson::StringBuffer> writer{buffer};
+
+        writer.StartObject();
+        writer.Key("tasks");
+        writer.Uint64(mGraph.size());
+        writer.Key("estimatedTasks");
+        writer.Uint64(mEstimatedTasks);
+        writer.Key("totalWorkMs");
+        writer.Int64(mTotalWork.count());
+        writer.Key("criticalPathMs");
+        writer.Int64(criticalPathDuration().count());
+        writer.Key("parallelism");
+        writer.Double(parallelism());
+        writer.Key("criticalPath");
+        writer.StartArray();
+
+        for (std::uint32_t task : mCriticalPath)
+        {
+            writer.StartObject();
+            writer.Key("task");
+            writer.String(mBuildCache.taskName(*mGraph.task(task)));
+            writer.Key("project");
+            writer.String(projectName(projectOf(*mGraph.task(task))));
+            writer.Key("durationMs");
+            writer.Int64(mDurations[task].count());
+            writer.Key("estimated");
+            writer.Bool(mEstimated[task]);
+            writer.EndObject();
+        }
+
+        writer.EndArray();
+        writer.Key("projects");
+        writer.StartArray();
+
+        for (const ProjectReport &project : mProjects)
+        {
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(project.name);
+            writer.Key("tasks");
+            writer.Uint64(project.tasks);
+            writer.Key("workMs");
+            writer.Int64(project.work.count());
+            writer.Key("criticalPathMs");
+            writer.Int64(project.criticalPath.count());
+            writer.EndObject();
+        }
+
+        writer.EndArray();
+        writer.EndObject();
+
+        return buffer.GetString();
+    }
+
+    [[nodiscard]] auto parallelism() const noexcept -> double
+    {
+        return criticalPathDuration().count() == 0 ? 0.0 : static_cast<double>(mTotalWork.count()) / static_cast<double>(criticalPathDuration().count());
+    }
+
+    [[nodiscard]] auto projects() const noexcept -> const std::vector<ProjectReport> &
+    {
+        return mProjects;
+    }
+
+    [[nodiscard]] auto remainingDuration(std::uint32_t task) const noexcept -> std::chrono::milliseconds
+    {
+        return mRemainingDurations[task];
+    }
+
+    [[nodiscard]] auto text() const -> std::string
+    {
+        std::ostringstream stream;
+        stream << std::fixed << std::setprecision(1);
+        stream << "Predicted build time: " << criticalPathDuration().count() << " ms\n";
+        stream << "Total work: " << mTotalWork.count() << " ms, parallelism " << parallelism() << "x, " << mEstimatedTasks << '/' << mGraph.size() << " task durations estimated\n";
+        stream << "Critical path (" << mCriticalPath.size() << " tasks):\n";
+
+        for (std::uint32_t task : mCriticalPath)
+        {
+            stream << "    " << std::setw(8) << mDurations[task].count() << " ms" << (mEstimated[task] ? "*  " : "   ") << mBuildCache.taskName(*mGraph.task(task)) << '\n';
+        }
+
+        stream << "Projects:\n";
+
+        for (const ProjectReport &project : mProjects)
+        {
+            const double share = mTotalWork.count() == 0 ? 0.0 : 100.0 * static_cast<double>(project.work.count()) / static_cast<double>(mTotalWork.count());
+            stream << "    " << std::setw(8) << project.work.count() << " ms " << std::setw(5) << share << "%  critical " << std::setw(8) << project.criticalPath.count() << " ms  " << project.name << " (" << project.tasks << " tasks)\n";
+        }
+
+        return stream.str();
+    }
+
+    [[nodiscard]] auto totalWork() const noexcept -> std::chrono::milliseconds
+    {
+        return mTotalWork;
+    }
+
+private:
+    auto collectCriticalPath() -> void
+    {
+        std::uint32_t task = 0;
+
+        for (std::uint32_t candidate = 1; candidate < mGraph.size(); ++candidate)
+        {
+            if (mRemainingDurations[task] < mRemainingDurations[candidate])
+            {
+                task = candidate;
+            }
+        }
+
+        while (task < mGraph.size())
+        {
+            mCriticalPath.push_back(task);
+            std::uint32_t next = mGraph.size();
+
+            for (std::uint32_t dependent : mGraph.dependents(task))
+            {
+                if (next == mGraph.size() || mRemainingDurations[next] < mRemainingDurations[dependent])
+                {
+                    next = dependent;
+                }
+            }
+
+            task = next;
+        }
+    }
+
+    auto collectProjects() -> void
+    {
+        std::unordered_map<const Project *, std::size_t> indexes;
+
+        auto projectReport = [&](std::uint32_t task) -> ProjectReport & {
+            const Project *project = projectOf(*mGraph.task(task));
+            const std::pair<std::unordered_map<const Project *, std::size_t>::iterator, bool> result = indexes.insert({project, mProjects.size()});
+
+            if (result.second)
+            {
+                mProjects.push_back(ProjectReport{.name = projectName(project)});
+            }
+
+            return mProjects[result.first->second];
+        };
+
+        for (std::uint32_t task = 0; task < mGraph.size(); ++task)
+        {
+            ProjectReport &report = projectReport(task);
+            report.tasks++;
+            report.work += mDurations[task];
+        }
+
+        for (std::uint32_t task : mCriticalPath)
+        {
+            projectReport(task).criticalPath += mDurations[task];
+        }
+
+        std::sort(mProjects.begin(), mProjects.end(), [](const ProjectReport &left, const ProjectReport &right) {
+            return left.work != right.work ? right.work < left.work : left.name < right.name;
+        });
+    }
+
+    auto computeRemainingDurations() -> void
+    {
+        for (auto it = mOrder.rbegin(); it != mOrder.rend(); ++it)
+        {
+            std::chrono::milliseconds longestChain{0};
+
+            for (std::uint32_t dependent : mGraph.dependents(*it))
+            {
+                longestChain = std::max(longestChain, mRemainingDurations[dependent]);
+            }
+
+            mRemainingDurations[*it] = longestChain + mDurations[*it];
+        }
+    }
+
+    auto estimateDurations() -> void
+    {
+        std::array<std::chrono::milliseconds, KINDS> kindWork{};
+        std::array<std::size_t, KINDS> kindTasks{};
+        std::chrono::milliseconds knownWork{0};
+        std::size_t knownTasks = 0;
+
+        for (std::uint32_t task = 0; task < mGraph.size(); ++task)
+        {
+            const std::optional<std::chrono::milliseconds> duration = mBuildCache.taskDuration(*mGraph.task(task));
+
+            if (duration)
+            {
+                mDurations[task] = *duration;
+                kindWork[mGraph.task(task)->index()] += *duration;
+                kindTasks[mGraph.task(task)->index()]++;
+                knownWork += *duration;
+                knownTasks++;
+            }
+            else
+            {
+                mEstimated[task] = true;
+                mEstimatedTasks++;
+            }
+        }
+
+        for (std::uint32_t task = 0; task < mGraph.size(); ++task)
+        {
+            if (mEstimated[task])
+            {
+                const std::size_t kind = mGraph.task(task)->index();
+
+                if (kindTasks[kind] != 0)
+                {
+                    mDurations[task] = kindWork[kind] / kindTasks[kind];
+                }
+                else if (knownTasks != 0)
+                {
+                    mDurations[task] = knownWork / knownTasks;
+                }
+                else
+                {
+                    mDurations[task] = DEFAULT_DURATION;
+                }
+            }
+
+            mTotalWork += mDurations[task];
+        }
+    }
+
+    [[nodiscard]] static auto projectName(const Project *project) -> std::string
+    {
+        return project == nullptr ? std::string{"(stl)"} : project->name();
+    }
+
+    [[nodiscard]] static auto projectOf(const BuildTask &task) -> const Project *
+    {
+        return std::visit([](auto &&value) -> const Project * {
+            using T = std::decay_t<decltype(value)>;
+
+            if constexpr (std::is_same_v<T, CompileHeaderUnitTask>)
+            {
+                return value.header->project();
+            }
+            else if constexpr (std::is_same_v<T, CompileSTLHeaderUnitTask>)
+            {
+                return nullptr;
+            }
+            else if constexpr (std::is_same_v<T, LinkModuleLibraryTask>)
+            {
+                return value.mod->source == nullptr ? nullptr : value.mod->source->project();
+            }
+            else if constexpr (requires { value.source; })
+            {
+                return value.source->project();
+            }
+            else
+            {
+                return value.project;
+            }
+        },
+                          task);
+    }
+
+    [[nodiscard]] auto sortTasks() -> bool
+    {
+        std::vector<std::size_t> remainingInputs;
+        remainingInputs.reserve(mGraph.size());
+        mOrder.reserve(mGraph.size());
+
+        for (std::uint32_t task = 0; task < mGraph.size(); ++task)
+        {
+            remainingInputs.push_back(mGraph.inputs(task).size());
+
+            if (remainingInputs.back() == 0)
+            {
+                mOrder.push_back(task);
+            }
+        }
+
+        for (std::size_t i = 0; i < mOrder.size(); ++i)
+        {
+            for (std::uint32_t dependent : mGraph.dependents(mOrder[i]))
+            {
+                if (--remainingInputs[dependent] == 0)
+                {
+                    mOrder.push_back(dependent);
+                }
+            }
+        }
+
+        return mOrder.size() == mGraph.size();
+    }
+
+    static constexpr std::size_t KINDS = std::variant_size_v<BuildTask>;
+    static constexpr std::chrono::milliseconds DEFAULT_DURATION{1000};
+
+    const BuildCache &mBuildCache;
+    const CompactBuildGraph &mGraph;
+    std::vector<std::chrono::milliseconds> mDurations;
+    std::vector<bool> mEstimated;
+    std::vector<std::chrono::milliseconds> mRemainingDurations;
+    std::vector<std::uint32_t> mOrder;
+    std::vector<std::uint32_t> mCriticalPath;
+    std::vector<ProjectReport> mProjects;
+    std::chrono::milliseconds mTotalWork{0};
+    std::size_t mEstimatedTasks = 0;
+};
+}
@@ -0,0 +1,173 @@
+#ifdef _MSC_VER
+export module abuild : build_scheduler;
+export import : build_report;
+#endif
+
+namespace abuild
+{
+export enum class SchedulingPolicy {
+    CriticalPath,
+    ModulesFirst
+};
+
+export class BuildSchedule
+{
+public:
+    BuildSchedule(const CompactBuildGraph &graph, const BuildReport &report, SchedulingPolicy policy) :
+        mPriorities(graph.size())
+    {
+        for (std::uint32_t task = 0; task < graph.size(); ++task)
+        {
+            const std::int64_t remaining = std::min(report.remainingDuration(task).count(), MAX_REMAINING);
+
+            if (policy == SchedulingPolicy::ModulesFirst && isGate(*graph.task(task)))
+            {
+                const std::int64_t fanOut = std::min(static_cast<std::int64_t>(graph.dependents(task).size()), MAX_FAN_OUT);
+                mPriorities[task] = GATE_PRIORITY + (fanOut << REMAINING_BITS) + remaining;
+            }
+            else
+            {
+                mPriorities[task] = remaining;
+            }
+        }
+    }
+
+    [[nodiscard]] auto priority(std::uint32_t task) const noexcept -> std::int64_t
+    {
+        return mPriorities[task];
+    }
+
+private:
+    [[nodiscard]] static auto isGate(const BuildTask &task) noexcept -> bool
+    {
+        return std::holds_alternative<CompileModuleInterfaceTask>(task)
+            || std::holds_alternative<CompileModulePartitionTask>(task)
+            || std::holds_alternative<CompileHeaderUnitTask>(task)
+            || std::holds_alternative<CompileSTLHeaderUnitTask>(task);
+    }
+
+    static constexpr int REMAINING_BITS = 32;
+    static constexpr std::int64_t MAX_REMAINING = (std::int64_t{1} << REMAINING_BITS) - 1;
+    static constexpr std::int64_t MAX_FAN_OUT = (std::int64_t{1} << 28) - 1;
+    static constexpr std::int64_t GATE_PRIORITY = std::int64_t{1} << 61;
+
+    std::vector<std::int64_t> mPriorities;
+};
+
+export class BuildSimulation
+{
+public:
+    BuildSimulation(const CompactBuildGraph &graph, const BuildReport &report, const BuildSchedule &schedule, std::size_t threads) :
+        mGraph{graph},
+        mReady(graph.size()),
+        mStart(graph.size()),
+        mFinish(graph.size()),
+        mThreads{std::max(threads, std::size_t{1})}
+    {
+        simulate(report, schedule);
+    }
+
+    [[nodiscard]] auto duration() const noexcept -> std::chrono::milliseconds
+    {
+        return mDuration;
+    }
+
+    [[nodiscard]] auto finish(std::uint32_t task) const noexcept -> std::chrono::milliseconds
+    {
+        return mFinish[task];
+    }
+
+    template<typename T>
+    [[nodiscard]] auto meanReadyTime() const noexcept -> std::chrono::milliseconds
+    {
+        std::chrono::milliseconds total{0};
+        std::int64_t count = 0;
+
+        for (std::uint32_t task = 0; task < mGraph.size(); ++task)
+        {
+            if (std::holds_alternative<T>(*mGraph.task(task)))
+            {
+                total += mReady[task];
+                count++;
+            }
+        }
+
+        return count == 0 ? std::chrono::milliseconds{0} : total / count;
+    }
+
+    [[nodiscard]] auto ready(std::uint32_t task) const noexcept -> std::chrono::milliseconds
+    {
+        return mReady[task];
+    }
+
+    [[nodiscard]] auto start(std::uint32_t task) const noexcept -> std::chrono::milliseconds
+    {
+        return mStart[task];
+    }
+
+    [[nodiscard]] auto utilization() const noexcept -> double
+    {
+        return mDuration.count() == 0 ? 0.0 : static_cast<double>(mWork.count()) / static_cast<double>(mDuration.count() * static_cast<std::int64_t>(mThreads));
+    }
+
+private:
+    using Event = std::pair<std::chrono::milliseconds, std::uint32_t>;
+
+    auto simulate(const BuildReport &report, const BuildSchedule &schedule) -> void
+    {
+        const auto byPriority = [&](std::uint32_t left, std::uint32_t right) {
+            return schedule.priority(left) != schedule.priority(right) ? schedule.priority(left) < schedule.priority(right) : right < left;
+        };
+
+        std::priority_queue<std::uint32_t, std::vector<std::uint32_t>, decltype(byPriority)> ready{byPriority};
+        std::priority_queue<Event, std::vector<Event>, std::greater<Event>> running;
+        std::vector<std::size_t> remainingInputs(mGraph.size());
+        std::chrono::milliseconds now{0};
+
+        for (std::uint32_t task = 0; task < mGraph.size(); ++task)
+        {
+            remainingInputs[task] = mGraph.inputs(task).size();
+
+            if (remainingInputs[task] == 0)
+            {
+                ready.push(task);
+            }
+        }
+
+        while (!ready.empty() || !running.empty())
+        {
+            while (!ready.empty() && running.size() < mThreads)
+            {
+                const std::uint32_t task = ready.top();
+                ready.pop();
+                mStart[task] = now;
+                mFinish[task] = now + report.duration(task);
+                mWork += report.duration(task);
+                running.push({mFinish[task], task});
+            }
+
+            const Event event = running.top();
+            running.pop();
+            now = event.first;
+            mDuration = now;
+
+            for (std::uint32_t dependent : mGraph.dependents(event.second))
+            {
+                if (--remainingInputs[dependent] == 0)
+                {
+                    mReady[dependent] = now;
+                    ready.push(dependent);
+                }
+            }
+        }
+    }
+
+    const CompactBuildGraph &mGraph;
+    std::vector<std::chrono::milliseconds> mReady;
+    std::vector<std::chrono::milliseconds> mStart;
+    std::vector<std::chrono::milliseconds> mFinish;
+    std::chrono::milliseconds mDuration{0};
+    std::chrono::milliseconds mWork{0};
+    std::size_t mThreads = 1;
+};
+}
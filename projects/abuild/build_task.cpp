@@ -1,6 +1,6 @@
 #ifdef _MSC_VER
 export module abuild : build_task;
-export import<astl.hpp>;
+export import : arena;
 #endif
 
 namespace abuild
@@ -40,13 +40,13 @@ export using BuildTask = std::variant<
 
 export struct CompileTask
 {
-    std::unordered_set<BuildTask *> inputTasks;
-    std::unordered_set<std::filesystem::path, PathHash> includePaths;
+    ArenaSet<BuildTask *> inputTasks;
+    ArenaSet<std::filesystem::path, PathHash> includePaths;
 };
 
 export struct LinkTask
 {
-    std::unordered_set<BuildTask *> inputTasks;
+    ArenaSet<BuildTask *> inputTasks;
 };
 
 export struct CompileHeaderUnitTask : CompileTask
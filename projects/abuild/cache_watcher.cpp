@@ -0,0 +1,287 @@
+#ifdef _MSC_VER
+export module abuild : cache_watcher;
+export import : build_cache;
+import : directory_watcher;
+import : project_scanner;
+import : code_scanner;
+import : dependency_scanner;
+import : incremental_scanner;
+#endif
+
+namespace abuild
+{
+export class CacheWatcher
+{
+public:
+    explicit CacheWatcher(BuildCache &cache) :
+        CacheWatcher{cache, std::thread::hardware_concurrency()}
+    {
+    }
+
+    CacheWatcher(BuildCache &cache, std::size_t threads) :
+        mBuildCache{cache},
+        mThreads{threads}
+    {
+        scan();
+    }
+
+    [[nodiscard]] auto addedFiles() const noexcept -> std::size_t
+    {
+        return mAddedFiles;
+    }
+
+    [[nodiscard]] auto fullScans() const noexcept -> std::size_t
+    {
+        return mFullScans;
+    }
+
+    [[nodiscard]] auto modifiedFiles() const noexcept -> std::size_t
+    {
+        return mModifiedFiles;
+    }
+
+    [[nodiscard]] auto update(std::chrono::milliseconds timeout) -> bool
+    {
+        std::vector<std::filesystem::path> paths = mWatcher->wait(timeout);
+
+        if (paths.empty())
+        {
+            return false;
+        }
+
+        for (std::vector<std::filesystem::path> more = mWatcher->wait(SETTLE_TIME); !more.empty(); more = mWatcher->wait(SETTLE_TIME))
+        {
+            paths.insert(paths.end(), more.begin(), more.end());
+        }
+
+        std::sort(paths.begin(), paths.end());
+        paths.erase(std::unique(paths.begin(), paths.end()), paths.end());
+
+        ChangedFiles changes;
+        std::vector<File *> added;
+        bool fullScanRequired = false;
+
+        for (const std::filesystem::path &path : paths)
+        {
+            fullScanRequired = collectChange(path, &changes, &added) || fullScanRequired;
+        }
+
+        if (!fullScanRequired && (!changes.sources.empty() || !changes.headers.empty()))
+        {
+            const IncrementalScanner scanner{mBuildCache, changes, mThreads};
+            fullScanRequired = scanner.fullScanRequired();
+            mModifiedFiles += scanner.modifiedFiles();
+        }
+
+        if (!fullScanRequired && !added.empty())
+        {
+            resolveAdded(added);
+            mAddedFiles += added.size();
+        }
+
+        if (fullScanRequired)
+        {
+            scan();
+        }
+
+        return true;
+    }
+
+private:
+    [[nodiscard]] auto addFile(const std::filesystem::path &path, ChangedFiles *changes, std::vector<File *> *added) -> bool
+    {
+        const std::unordered_map<std::string, std::string>::const_iterator project = mProjects.find(path.parent_path().string());
+
+        if (project == mProjects.end())
+        {
+            return false;
+        }
+
+        if (mBuildCache.settings().cppSourceExtensions().contains(path.extension().string()))
+        {
+            if (mBuildCache.settings().executableFilenames().contains(path.stem().string()) && mBuildCache.project(project->second)->type() != Project::Type::Executable)
+            {
+                return false;
+            }
+
+            Source *source = mBuildCache.addSource(path, project->second);
+            mSources.insert({path.string(), source});
+            changes->sources.push_back(source);
+            added->push_back(source);
+        }
+        else
+        {
+            Header *header = mBuildCache.addHeader(path, project->second);
+            mHeaders.insert({path.string(), header});
+            changes->headers.push_back(header);
+            added->push_back(header);
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] auto collectChange(const std::filesystem::path &path, ChangedFiles *changes, std::vector<File *> *added) -> bool
+    {
+        std::error_code error;
+        const std::filesystem::file_status status = std::filesystem::status(path, error);
+        const std::string name = path.filename().string();
+
+        if (std::unordered_map<std::string, Source *>::const_iterator it = mSources.find(path.string()); it != mSources.end())
+        {
+            changes->sources.push_back(it->second);
+            return !std::filesystem::is_regular_file(status);
+        }
+
+        if (std::unordered_map<std::string, Header *>::const_iterator it = mHeaders.find(path.string()); it != mHeaders.end())
+        {
+            changes->headers.push_back(it->second);
+            return !std::filesystem::is_regular_file(status);
+        }
+
+        if (name == ".abuild" || path.extension().string() == ".abuild")
+        {
+            return true;
+        }
+
+        if (std::filesystem::is_directory(status) || mDirectories.contains(path.string()))
+        {
+            return !isIgnoreDirectory(name);
+        }
+
+        return std::filesystem::is_regular_file(status) && isCppFile(path) && !addFile(path, changes, added);
+    }
+
+    [[nodiscard]] static auto hasUnresolved(File *file, const std::unordered_set<std::string> &names) -> bool
+    {
+        for (const Dependency &dependency : file->dependencies())
+        {
+            const bool unresolved = std::visit([&](auto &&value) {
+                if constexpr (requires { value.header; })
+                {
+                    return !value.header && names.contains(std::filesystem::path{value.name}.filename().string());
+                }
+                else if constexpr (requires { value.source; })
+                {
+                    return !value.source && names.contains(std::filesystem::path{value.name}.filename().string());
+                }
+                else
+                {
+                    return false;
+                }
+            },
+                                               dependency);
+
+            if (unresolved)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] auto isCppFile(const std::filesystem::path &path) const -> bool
+    {
+        const std::string extension = path.extension().string();
+        return mBuildCache.settings().cppSourceExtensions().contains(extension) || mBuildCache.settings().cppHeaderExtensions().contains(extension);
+    }
+
+    [[nodiscard]] auto isIgnoreDirectory(const std::string &name) const -> bool
+    {
+        return name.empty() || name.front() == '.' || mBuildCache.settings().ignoreDirectories().contains(name);
+    }
+
+    auto resolveAdded(const std::vector<File *> &added) -> void
+    {
+        std::unordered_set<std::string> names;
+
+        for (const File *file : added)
+        {
+            names.insert(file->path().filename().string());
+        }
+
+        std::vector<File *> files;
+
+        for (Source *source : mBuildCache.sources())
+        {
+            if (hasUnresolved(source, names))
+            {
+                files.push_back(source);
+            }
+        }
+
+        for (Header *header : mBuildCache.headers())
+        {
+            if (hasUnresolved(header, names))
+            {
+                files.push_back(header);
+            }
+        }
+
+        for (const File *file : files)
+        {
+            mBuildCache.removeWarnings(file, "DependencyScanner");
+        }
+
+        DependencyScanner{mBuildCache, files};
+    }
+
+    auto scan() -> void
+    {
+        BuildCache cache{mBuildCache.projectRoot()};
+
+        for (Toolchain *toolchain : mBuildCache.toolchains())
+        {
+            cache.addToolchain(*toolchain);
+        }
+
+        cache.setTaskDurations(mBuildCache.taskDurations());
+        cache.setTaskStates(mBuildCache.taskStates());
+        cache.trace() = std::move(mBuildCache.trace());
+        mBuildCache = std::move(cache);
+        mWatcher = std::make_unique<DirectoryWatcher>();
+        mDirectories.clear();
+        mProjects.clear();
+        mSources.clear();
+        mHeaders.clear();
+
+        const ProjectScanner projectScanner{mBuildCache, mThreads};
+
+        for (const std::filesystem::path &directory : projectScanner.directories())
+        {
+            mWatcher->watch(directory);
+            mDirectories.insert(directory.string());
+        }
+
+        CodeScanner{mBuildCache, mThreads};
+        DependencyScanner{mBuildCache};
+
+        for (Source *source : mBuildCache.sources())
+        {
+            mSources.insert({source->path().string(), source});
+            mProjects.insert({source->path().parent_path().string(), source->project()->name()});
+        }
+
+        for (Header *header : mBuildCache.headers())
+        {
+            mHeaders.insert({header->path().string(), header});
+            mProjects.insert({header->path().parent_path().string(), header->project()->name()});
+        }
+
+        ++mFullScans;
+    }
+
+    static constexpr std::chrono::milliseconds SETTLE_TIME{50};
+
+    BuildCache &mBuildCache;
+    std::size_t mThreads = 0;
+    std::size_t mAddedFiles = 0;
+    std::size_t mFullScans = 0;
+    std::size_t mModifiedFiles = 0;
+    std::unique_ptr<DirectoryWatcher> mWatcher;
+    std::unordered_set<std::string> mDirectories;
+    std::unordered_map<std::string, std::string> mProjects;
+    std::unordered_map<std::string, Source *> mSources;
+    std::unordered_map<std::string, Header *> mHeaders;
+};
+}
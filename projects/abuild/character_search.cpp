@@ -0,0 +1,62 @@
+#ifdef _MSC_VER
+module;
+
+#    include <intrin.h>
+
+module abuild : character_search;
+import<astl.hpp>;
+#elif defined(__SSE2__)
+// clang-format off
+import <immintrin.h>;
+// clang-format on
+#endif
+
+namespace abuild
+{
+template<char... Characters>
+[[nodiscard]] auto findFirstOf(std::string_view content, std::size_t position) noexcept -> std::size_t
+{
+    const char *data = content.data();
+    const std::size_t size = content.size();
+
+#ifdef __AVX2__
+    for (; position + 32 <= size; position += 32)
+    {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + position));
+        __m256i matches = _mm256_setzero_si256();
+        ((matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(Characters)))), ...);
+        const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(matches));
+
+        if (mask != 0)
+        {
+            return position + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    for (; position + 16 <= size; position += 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + position));
+        __m128i matches = _mm_setzero_si128();
+        ((matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(Characters)))), ...);
+        const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(matches));
+
+        if (mask != 0)
+        {
+            return position + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+#endif
+
+    for (; position < size; ++position)
+    {
+        if (((data[position] == Characters) || ...))
+        {
+            return position;
+        }
+    }
+
+    return position;
+}
+}
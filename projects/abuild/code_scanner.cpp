@@ -3,6 +3,7 @@ export module abuild : code_scanner;
 export import : tokenizer;
 import : build_cache;
 import : settings;
+import : thread_pool;
 #endif
 
 namespace abuild
@@ -11,21 +12,56 @@ export class CodeScanner
 {
 public:
     explicit CodeScanner(BuildCache &cache) :
-        mBuildCache{cache}
+        CodeScanner{cache, std::thread::hardware_concurrency()}
     {
-        scanSources();
-        scanHeaders();
+    }
+
+    CodeScanner(BuildCache &cache, std::size_t threads) :
+        CodeScanner{cache, cache.sources(), cache.headers(), threads}
+    {
+    }
+
+    CodeScanner(BuildCache &cache, std::size_t threads, std::function<void(File *)> fileScanned) :
+        CodeScanner{cache, cache.sources(), cache.headers(), threads, std::move(fileScanned)}
+    {
+    }
+
+    CodeScanner(BuildCache &cache, const std::vector<Source *> &sources, const std::vector<Header *> &headers, std::size_t threads, std::function<void(File *)> fileScanned = {}) :
+        mBuildCache{cache},
+        mFileScanned{std::move(fileScanned)}
+    {
+        const TraceSpan span{mBuildCache.trace(), "CodeScanner", "CodeScanner"};
+        scanSources(sources, threads);
+        scanHeaders(headers, threads);
     }
 
 private:
-    [[nodiscard]] auto isSource(const std::string token) -> bool
+    struct ModuleDeclaration
+    {
+        std::string mod;
+        std::string partition;
+        ModuleVisibility visibility = ModuleVisibility::Private;
+    };
+
+    struct ScanResult
+    {
+        std::vector<ModuleDeclaration> declarations;
+        std::vector<Warning> warnings;
+    };
+
+    [[nodiscard]] auto isSource(std::string_view token) -> bool
     {
         return mBuildCache.settings().cppSourceExtensions().contains(std::filesystem::path{token}.extension().string());
     }
 
-    [[nodiscard]] auto isSTLHeader(const std::string token) -> bool
+    [[nodiscard]] auto isSTLHeader(std::string_view token) -> bool
+    {
+        return CPP_STL.contains(std::string{token});
+    }
+
+    [[nodiscard]] auto contentHash(const FileView &view) const noexcept -> Digest
     {
-        return CPP_STL.contains(token);
+        return mBuildCache.settings().preambleThreshold() == 0 ? view.hash() : Digest{};
     }
 
     [[nodiscard]] auto dependencyVisibility(TokenVisibility visibility) -> DependencyVisibility
@@ -54,35 +90,35 @@ private:
         throw std::logic_error{"Unknown TokenVisibility value: " + std::to_string(static_cast<std::underlying_type_t<TokenVisibility>>(visibility))};
     }
 
-    auto processImportIncludeExternalToken(const ImportIncludeExternalToken *value, File *file) -> void
+    auto processImportIncludeExternalToken(const ImportIncludeExternalToken *value, File *file, ScanResult *result) -> void
     {
         if (isSource(value->name))
         {
-            mBuildCache.addWarning(Warning{COMPONENT, "Importing '" + value->name + "' (source) is unsupported. Only headers can be imported. Ignoring. (" + file->path().string() + ')'});
+            result->warnings.push_back(Warning{COMPONENT, "Importing '" + std::string{value->name} + "' (source) is unsupported. Only headers can be imported. Ignoring. (" + file->path().string() + ')'});
         }
         else if (isSTLHeader(value->name))
         {
-            file->addDependency(ImportSTLHeaderDependency{.name = value->name, .visibility = dependencyVisibility(value->visibility)});
+            file->addDependency(ImportSTLHeaderDependency{.name = std::string{value->name}, .visibility = dependencyVisibility(value->visibility)});
         }
         else
         {
-            file->addDependency(ImportExternalHeaderDependency{.name = value->name, .visibility = dependencyVisibility(value->visibility)});
+            file->addDependency(ImportExternalHeaderDependency{.name = std::string{value->name}, .visibility = dependencyVisibility(value->visibility)});
         }
     }
 
-    auto processImportIncludeLocalToken(const ImportIncludeLocalToken *value, File *file) -> void
+    auto processImportIncludeLocalToken(const ImportIncludeLocalToken *value, File *file, ScanResult *result) -> void
     {
         if (isSource(value->name))
         {
-            mBuildCache.addWarning(Warning{COMPONENT, "Importing '" + value->name + "' (source) is unsupported. Only headers can be imported. Ignoring. (" + file->path().string() + ')'});
+            result->warnings.push_back(Warning{COMPONENT, "Importing '" + std::string{value->name} + "' (source) is unsupported. Only headers can be imported. Ignoring. (" + file->path().string() + ')'});
         }
         else if (isSTLHeader(value->name))
         {
-            file->addDependency(ImportSTLHeaderDependency{.name = value->name, .visibility = dependencyVisibility(value->visibility)});
+            file->addDependency(ImportSTLHeaderDependency{.name = std::string{value->name}, .visibility = dependencyVisibility(value->visibility)});
         }
         else
         {
-            file->addDependency(ImportLocalHeaderDependency{.name = value->name, .visibility = dependencyVisibility(value->visibility)});
+            file->addDependency(ImportLocalHeaderDependency{.name = std::string{value->name}, .visibility = dependencyVisibility(value->visibility)});
         }
     }
 
@@ -90,15 +126,15 @@ private:
     {
         if (isSource(value->name))
         {
-            file->addDependency(IncludeExternalSourceDependency{.name = value->name, .visibility = DependencyVisibility::Public});
+            file->addDependency(IncludeExternalSourceDependency{.name = std::string{value->name}, .visibility = DependencyVisibility::Public});
         }
         else if (isSTLHeader(value->name))
         {
-            file->addDependency(IncludeSTLHeaderDependency{.name = value->name, .visibility = DependencyVisibility::Public});
+            file->addDependency(IncludeSTLHeaderDependency{.name = std::string{value->name}, .visibility = DependencyVisibility::Public});
         }
         else
         {
-            file->addDependency(IncludeExternalHeaderDependency{.name = value->name, .visibility = DependencyVisibility::Public});
+            file->addDependency(IncludeExternalHeaderDependency{.name = std::string{value->name}, .visibility = DependencyVisibility::Public});
         }
     }
 
@@ -106,35 +142,35 @@ private:
     {
         if (isSource(value->name))
         {
-            file->addDependency(IncludeLocalSourceDependency{.name = value->name, .visibility = DependencyVisibility::Public});
+            file->addDependency(IncludeLocalSourceDependency{.name = std::string{value->name}, .visibility = DependencyVisibility::Public});
         }
         else if (isSTLHeader(value->name))
         {
-            file->addDependency(IncludeSTLHeaderDependency{.name = value->name, .visibility = DependencyVisibility::Public});
+            file->addDependency(IncludeSTLHeaderDependency{.name = std::string{value->name}, .visibility = DependencyVisibility::Public});
         }
         else
         {
-            file->addDependency(IncludeLocalHeaderDependency{.name = value->name, .visibility = DependencyVisibility::Public});
+            file->addDependency(IncludeLocalHeaderDependency{.name = std::string{value->name}, .visibility = DependencyVisibility::Public});
         }
     }
 
-    auto processHeader(const Token &token, Header *file) -> void
+    auto processHeader(const Token &token, Header *file, ScanResult *result) -> void
     {
         if (auto *value = std::get_if<ModuleToken>(&token))
         {
-            mBuildCache.addWarning(Warning{COMPONENT, "Declaring modules in headers is unsupported. Ignoring. (" + file->path().string() + ')'});
+            result->warnings.push_back(Warning{COMPONENT, "Declaring modules in headers is unsupported. Ignoring. (" + file->path().string() + ')'});
             return;
         }
 
         if (auto *value = std::get_if<ModulePartitionToken>(&token))
         {
-            mBuildCache.addWarning(Warning{COMPONENT, "Declaring module partitions in headers is unsupported. Ignoring. (" + file->path().string() + ')'});
+            result->warnings.push_back(Warning{COMPONENT, "Declaring module partitions in headers is unsupported. Ignoring. (" + file->path().string() + ')'});
             return;
         }
 
         if (auto *value = std::get_if<ImportModulePartitionToken>(&token))
         {
-            mBuildCache.addWarning(Warning{COMPONENT, "Importing module partitions in headers is unsupported. Ignoring. (" + file->path().string() + ')'});
+            result->warnings.push_back(Warning{COMPONENT, "Importing module partitions in headers is unsupported. Ignoring. (" + file->path().string() + ')'});
             return;
         }
 
@@ -152,42 +188,42 @@ private:
 
         if (auto *value = std::get_if<ImportModuleToken>(&token))
         {
-            file->addDependency(ImportModuleDependency{.name = value->name, .visibility = dependencyVisibility(value->visibility)});
+            file->addDependency(ImportModuleDependency{.name = std::string{value->name}, .visibility = dependencyVisibility(value->visibility)});
             return;
         }
 
         if (auto *value = std::get_if<ImportIncludeLocalToken>(&token))
         {
-            processImportIncludeLocalToken(value, file);
+            processImportIncludeLocalToken(value, file, result);
             return;
         }
 
         if (auto *value = std::get_if<ImportIncludeExternalToken>(&token))
         {
-            processImportIncludeExternalToken(value, file);
+            processImportIncludeExternalToken(value, file, result);
             return;
         }
 
         throw std::logic_error{"Unknown token type. (" + file->path().string() + ')'};
     }
 
-    auto processSource(const Token &token, Source *file) -> void
+    auto processSource(const Token &token, Source *file, ScanResult *result) -> void
     {
         if (auto *value = std::get_if<ModuleToken>(&token))
         {
-            mBuildCache.addModuleInterface(value->name, moduleVisibility(value->visibility), file);
+            result->declarations.push_back(ModuleDeclaration{.mod = std::string{value->name}, .visibility = moduleVisibility(value->visibility)});
             return;
         }
 
         if (auto *value = std::get_if<ModulePartitionToken>(&token))
         {
-            mBuildCache.addModulePartition(value->mod, value->name, moduleVisibility(value->visibility), file);
+            result->declarations.push_back(ModuleDeclaration{.mod = std::string{value->mod}, .partition = std::string{value->name}, .visibility = moduleVisibility(value->visibility)});
             return;
         }
 
         if (auto *value = std::get_if<ImportModulePartitionToken>(&token))
         {
-            file->addDependency(ImportModulePartitionDependency{.name = value->name, .visibility = dependencyVisibility(value->visibility)});
+            file->addDependency(ImportModulePartitionDependency{.name = std::string{value->name}, .visibility = dependencyVisibility(value->visibility)});
             return;
         }
 
@@ -205,62 +241,139 @@ private:
 
         if (auto *value = std::get_if<ImportModuleToken>(&token))
         {
-            file->addDependency(ImportModuleDependency{.name = value->name, .visibility = dependencyVisibility(value->visibility)});
+            file->addDependency(ImportModuleDependency{.name = std::string{value->name}, .visibility = dependencyVisibility(value->visibility)});
             return;
         }
 
         if (auto *value = std::get_if<ImportIncludeLocalToken>(&token))
         {
-            processImportIncludeLocalToken(value, file);
+            processImportIncludeLocalToken(value, file, result);
             return;
         }
 
         if (auto *value = std::get_if<ImportIncludeExternalToken>(&token))
         {
-            processImportIncludeExternalToken(value, file);
+            processImportIncludeExternalToken(value, file, result);
             return;
         }
 
         throw std::logic_error{"Unknown token type. (" + file->path().string() + ')'};
     }
 
-    auto scanHeader(Header *header) -> void
+    auto mergeResult(ScanResult &result, Source *source) -> void
     {
-        Tokenizer tokenizer{header->content()};
+        for (ModuleDeclaration &declaration : result.declarations)
+        {
+            if (declaration.partition.empty())
+            {
+                mBuildCache.addModuleInterface(declaration.mod, declaration.visibility, source);
+            }
+            else
+            {
+                mBuildCache.addModulePartition(declaration.mod, std::move(declaration.partition), declaration.visibility, source);
+            }
+        }
+
+        mergeWarnings(result);
+    }
+
+    auto mergeWarnings(ScanResult &result) -> void
+    {
+        for (Warning &warning : result.warnings)
+        {
+            mBuildCache.addWarning(std::move(warning));
+        }
+    }
+
+    template<typename T, typename Scan>
+    [[nodiscard]] static auto scanFiles(const std::vector<T *> &files, std::size_t threads, Scan scan) -> std::vector<ScanResult>
+    {
+        std::vector<ScanResult> results(files.size());
+
+        if (threads <= 1 || files.size() <= 1)
+        {
+            for (std::size_t i = 0; i < files.size(); ++i)
+            {
+                scan(files[i], &results[i]);
+            }
+        }
+        else
+        {
+            ThreadPool pool{std::min(threads, files.size())};
+
+            for (std::size_t i = 0; i < files.size(); ++i)
+            {
+                pool.run([&, i] { scan(files[i], &results[i]); });
+            }
+
+            pool.wait();
+        }
+
+        return results;
+    }
+
+    auto scanHeader(Header *header, ScanResult *result) -> void
+    {
+        const TraceSpan span{mBuildCache.trace(), "CodeScanner", [header] { return header->path().string(); }};
+        const FileView view = header->view();
+        Tokenizer tokenizer{view.content(), mBuildCache.settings().preambleThreshold()};
+        header->setContentHash(contentHash(view));
 
         for (Token token = tokenizer.next(); !std::holds_alternative<std::monostate>(token); token = tokenizer.next())
         {
-            processHeader(token, header);
+            processHeader(token, header, result);
+        }
+
+        if (mFileScanned)
+        {
+            mFileScanned(header);
         }
     }
 
-    auto scanSource(Source *source) -> void
+    auto scanSource(Source *source, ScanResult *result) -> void
     {
-        Tokenizer tokenizer{source->content()};
+        const TraceSpan span{mBuildCache.trace(), "CodeScanner", [source] { return source->path().string(); }};
+        const FileView view = source->view();
+        Tokenizer tokenizer{view.content(), mBuildCache.settings().preambleThreshold()};
+        source->setContentHash(contentHash(view));
 
         for (Token token = tokenizer.next(); !std::holds_alternative<std::monostate>(token); token = tokenizer.next())
         {
-            processSource(token, source);
+            processSource(token, source, result);
+        }
+
+        if (mFileScanned)
+        {
+            mFileScanned(source);
         }
     }
 
-    auto scanHeaders() -> void
+    auto scanHeaders(const std::vector<Header *> &headers, std::size_t threads) -> void
     {
-        for (const std::unique_ptr<Header> &header : mBuildCache.headers())
+        std::vector<ScanResult> results = scanFiles(headers, threads, [&](Header *header, ScanResult *result) {
+            scanHeader(header, result);
+        });
+
+        for (ScanResult &result : results)
         {
-            scanHeader(header.get());
+            mergeWarnings(result);
         }
     }
 
-    auto scanSources() -> void
+    auto scanSources(const std::vector<Source *> &sources, std::size_t threads) -> void
     {
-        for (const std::unique_ptr<Source> &source : mBuildCache.sources())
+        std::vector<ScanResult> results = scanFiles(sources, threads, [&](Source *source, ScanResult *result) {
+            scanSource(source, result);
+        });
+
+        for (std::size_t i = 0; i < results.size(); ++i)
         {
-            scanSource(source.get());
+            mergeResult(results[i], sources[i]);
         }
     }
 
     BuildCache &mBuildCache;
+    std::function<void(File *)> mFileScanned;
     static constexpr char COMPONENT[] = "CodeScanner";
     const std::unordered_set<std::string> CPP_STL = {
         "algorithm",
@@ -0,0 +1,590 @@
+#ifdef _MSC_VER
+export module abuild : command_builder;
+export import : build_cache;
+import : file_view;
+#endif
+
+namespace abuild
+{
+export struct Command
+{
+    std::filesystem::path executable;
+    std::vector<std::string> arguments;
+};
+
+export class CommandBuilder
+{
+public:
+    CommandBuilder(const BuildCache &cache, const Toolchain &toolchain) :
+        mBuildCache{cache},
+        mToolchain{toolchain},
+        mBuildRoot{cache.projectRoot() / cache.settings().buildDirectory() / toolchain.name}
+    {
+    }
+
+    [[nodiscard]] auto bmi(const BuildTask &task) const -> std::optional<std::filesystem::path>
+    {
+        return std::visit([&](auto &&value) -> std::optional<std::filesystem::path> {
+            using T = std::decay_t<decltype(value)>;
+
+            if constexpr (std::is_same_v<T, CompileHeaderUnitTask> || std::is_same_v<T, CompileSTLHeaderUnitTask> || std::is_same_v<T, CompileModuleInterfaceTask> || std::is_same_v<T, CompileModulePartitionTask>)
+            {
+                return bmi(value);
+            }
+            else
+            {
+                return std::nullopt;
+            }
+        },
+                          task);
+    }
+
+    [[nodiscard]] auto buildRoot() const noexcept -> const std::filesystem::path &
+    {
+        return mBuildRoot;
+    }
+
+    [[nodiscard]] auto commands(const BuildTask &task) const -> std::vector<Command>
+    {
+        return std::visit([&](auto &&value) { return commands(value); }, task);
+    }
+
+    [[nodiscard]] auto moduleMapper() const -> std::filesystem::path
+    {
+        return modulesDirectory() / "module.mapper";
+    }
+
+    [[nodiscard]] auto outputs(const BuildTask &task) const -> std::vector<std::filesystem::path>
+    {
+        return std::visit([&](auto &&value) { return outputs(value); }, task);
+    }
+
+    [[nodiscard]] auto systemHeader(std::string_view name) const -> std::optional<std::filesystem::path>
+    {
+        std::error_code error;
+
+        for (const std::filesystem::path &directory : mToolchain.systemIncludePaths)
+        {
+            if (std::filesystem::is_regular_file(directory / name, error))
+            {
+                return (directory / name).lexically_normal();
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    [[nodiscard]] auto toolchain() const noexcept -> const Toolchain &
+    {
+        return mToolchain;
+    }
+
+    auto writeModuleMapper() const -> void
+    {
+        if (mToolchain.type != Toolchain::Type::GCC)
+        {
+            return;
+        }
+
+        const std::string content = moduleMapperContent();
+        std::error_code error;
+
+        if (std::filesystem::exists(moduleMapper(), error) && FileView{moduleMapper()}.content() == content)
+        {
+            return;
+        }
+
+        std::filesystem::create_directories(modulesDirectory());
+        std::ofstream file{moduleMapper(), std::ios::binary | std::ios::trunc};
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+
+        if (!file)
+        {
+            throw std::runtime_error{"Failed to write module mapper '" + moduleMapper().string() + "'."};
+        }
+    }
+
+private:
+    auto addCompileInputs(const CompileTask &task, std::vector<std::string> *arguments) const -> void
+    {
+        std::vector<std::string> inputs;
+
+        for (const BuildTask *input : task.inputTasks)
+        {
+            if (const auto *headerUnit = std::get_if<CompileHeaderUnitTask>(input))
+            {
+                inputs.push_back(headerUnitInput(headerUnit->header->path().string(), bmi(*headerUnit)));
+            }
+            else if (const auto *stlHeaderUnit = std::get_if<CompileSTLHeaderUnitTask>(input))
+            {
+                inputs.push_back(headerUnitInput(stlHeaderUnit->name, bmi(*stlHeaderUnit)));
+            }
+        }
+
+        std::sort(inputs.begin(), inputs.end());
+
+        for (const std::string &input : inputs)
+        {
+            switch (mToolchain.type)
+            {
+            case Toolchain::Type::Clang:
+                arguments->push_back("-fmodule-file=" + input);
+                break;
+            case Toolchain::Type::GCC:
+                break;
+            case Toolchain::Type::MSVC:
+                arguments->push_back("/headerUnit");
+                arguments->push_back(input);
+                break;
+            }
+        }
+    }
+
+    auto addCompilerFlags(std::vector<std::string> *arguments) const -> void
+    {
+        addFlags(mToolchain.compilerFlags, arguments);
+    }
+
+    static auto addFlags(const std::unordered_set<std::string> &flags, std::vector<std::string> *arguments) -> void
+    {
+        std::vector<std::string> sorted{flags.begin(), flags.end()};
+        std::sort(sorted.begin(), sorted.end());
+
+        for (const std::string &flag : sorted)
+        {
+            std::istringstream stream{flag};
+            std::string part;
+
+            while (stream >> part)
+            {
+                arguments->push_back(part);
+            }
+        }
+    }
+
+    auto addIncludePaths(const CompileTask &task, std::vector<std::string> *arguments) const -> void
+    {
+        std::vector<std::string> paths;
+
+        for (const std::filesystem::path &path : task.includePaths)
+        {
+            paths.push_back(isMSVC() ? "/I" + path.string() : "-I" + path.string());
+        }
+
+        std::sort(paths.begin(), paths.end());
+        arguments->insert(arguments->end(), paths.begin(), paths.end());
+    }
+
+    auto addModulePath(std::vector<std::string> *arguments) const -> void
+    {
+        switch (mToolchain.type)
+        {
+        case Toolchain::Type::Clang:
+            arguments->push_back("-fprebuilt-module-path=" + modulesDirectory().string());
+            break;
+        case Toolchain::Type::GCC:
+            arguments->push_back("-fmodule-mapper=" + moduleMapper().string());
+            break;
+        case Toolchain::Type::MSVC:
+            arguments->push_back("/ifcSearchDir");
+            arguments->push_back(modulesDirectory().string());
+            break;
+        }
+    }
+
+    [[nodiscard]] auto archive(const std::string &name) const -> std::filesystem::path
+    {
+        return mBuildRoot / "lib" / (isMSVC() ? name + ".lib" : "lib" + name + ".a");
+    }
+
+    [[nodiscard]] auto archiveCommand(const std::filesystem::path &output, const LinkTask &task) const -> std::vector<Command>
+    {
+        const std::vector<std::string> inputs = objects(task);
+
+        if (inputs.empty())
+        {
+            return {};
+        }
+
+        std::vector<std::string> arguments;
+        addFlags(mToolchain.archiverFlags, &arguments);
+
+        if (isMSVC())
+        {
+            arguments.push_back("/OUT:" + output.string());
+        }
+        else
+        {
+            arguments.push_back("rcs");
+            arguments.push_back(output.string());
+        }
+
+        arguments.insert(arguments.end(), inputs.begin(), inputs.end());
+        return {Command{.executable = mToolchain.archiver, .arguments = std::move(arguments)}};
+    }
+
+    [[nodiscard]] auto bmi(const std::string &name) const -> std::filesystem::path
+    {
+        switch (mToolchain.type)
+        {
+        case Toolchain::Type::Clang:
+            return modulesDirectory() / (name + ".pcm");
+        case Toolchain::Type::GCC:
+            return modulesDirectory() / (name + ".gcm");
+        case Toolchain::Type::MSVC:
+            return modulesDirectory() / (name + ".ifc");
+        }
+
+        return {};
+    }
+
+    [[nodiscard]] auto bmi(const CompileHeaderUnitTask &task) const -> std::filesystem::path
+    {
+        return bmi(task.header->name());
+    }
+
+    [[nodiscard]] auto bmi(const CompileSTLHeaderUnitTask &task) const -> std::filesystem::path
+    {
+        return bmi(task.name);
+    }
+
+    [[nodiscard]] auto bmi(const CompileModuleInterfaceTask &task) const -> std::filesystem::path
+    {
+        return bmi(mBuildCache.cppModule(task.source)->name);
+    }
+
+    [[nodiscard]] auto bmi(const CompileModulePartitionTask &task) const -> std::filesystem::path
+    {
+        const ModulePartition *partition = mBuildCache.cppModulePartition(task.source);
+        return bmi(partition->mod->name + '-' + partition->name);
+    }
+
+    [[nodiscard]] auto commands(const CompileHeaderUnitTask &task) const -> std::vector<Command>
+    {
+        std::vector<std::string> arguments = compileArguments(task);
+
+        switch (mToolchain.type)
+        {
+        case Toolchain::Type::Clang:
+            arguments.insert(arguments.end(), {"-fmodule-header", "-x", "c++-header", task.header->path().string(), "-o", bmi(task).string()});
+            break;
+        case Toolchain::Type::GCC:
+            arguments.insert(arguments.end(), {"-fmodule-header", "-x", "c++-header", task.header->path().string()});
+            break;
+        case Toolchain::Type::MSVC:
+            arguments.insert(arguments.end(), {"/exportHeader", "/ifcOutput", bmi(task).string(), task.header->path().string()});
+            break;
+        }
+
+        return {Command{.executable = mToolchain.compiler, .arguments = std::move(arguments)}};
+    }
+
+    [[nodiscard]] auto commands(const CompileSTLHeaderUnitTask &task) const -> std::vector<Command>
+    {
+        std::vector<std::string> arguments = compileArguments(task);
+
+        switch (mToolchain.type)
+        {
+        case Toolchain::Type::Clang:
+            arguments.insert(arguments.end(), {"-fmodule-header=system", "-x", "c++-system-header", task.name, "-o", bmi(task).string()});
+            break;
+        case Toolchain::Type::GCC:
+            arguments.insert(arguments.end(), {"-fmodule-header=system", "-x", "c++-system-header", task.name});
+            break;
+        case Toolchain::Type::MSVC:
+            arguments.insert(arguments.end(), {"/exportHeader", "/headerName:angle", task.name, "/ifcOutput", bmi(task).string()});
+            break;
+        }
+
+        return {Command{.executable = mToolchain.compiler, .arguments = std::move(arguments)}};
+    }
+
+    [[nodiscard]] auto commands(const CompileModuleInterfaceTask &task) const -> std::vector<Command>
+    {
+        return moduleCommands(task, task.source, bmi(task));
+    }
+
+    [[nodiscard]] auto commands(const CompileModulePartitionTask &task) const -> std::vector<Command>
+    {
+        return moduleCommands(task, task.source, bmi(task));
+    }
+
+    [[nodiscard]] auto commands(const CompileSourceTask &task) const -> std::vector<Command>
+    {
+        std::vector<std::string> arguments = compileArguments(task);
+
+        if (isMSVC())
+        {
+            arguments.insert(arguments.end(), {"/Fo" + object(task.source).string(), task.source->path().string()});
+        }
+        else
+        {
+            arguments.insert(arguments.end(), {task.source->path().string(), "-o", object(task.source).string()});
+        }
+
+        return {Command{.executable = mToolchain.compiler, .arguments = std::move(arguments)}};
+    }
+
+    [[nodiscard]] auto commands(const LinkExecutableTask &task) const -> std::vector<Command>
+    {
+        std::vector<std::string> inputs = objects(task);
+
+        for (const std::filesystem::path &library : libraries(task))
+        {
+            inputs.push_back(library.string());
+        }
+
+        std::vector<std::string> arguments;
+        addFlags(mToolchain.linkerFlags, &arguments);
+
+        if (isMSVC())
+        {
+            arguments.push_back("/OUT:" + executable(task.project).string());
+            arguments.insert(arguments.end(), inputs.begin(), inputs.end());
+            return {Command{.executable = mToolchain.linker, .arguments = std::move(arguments)}};
+        }
+        else
+        {
+            arguments.insert(arguments.end(), inputs.begin(), inputs.end());
+            arguments.insert(arguments.end(), {"-o", executable(task.project).string()});
+            return {Command{.executable = mToolchain.compiler, .arguments = std::move(arguments)}};
+        }
+    }
+
+    [[nodiscard]] auto commands(const LinkLibraryTask &task) const -> std::vector<Command>
+    {
+        return archiveCommand(archive(task.project->name()), task);
+    }
+
+    [[nodiscard]] auto commands(const LinkModuleLibraryTask &task) const -> std::vector<Command>
+    {
+        return archiveCommand(archive(task.mod->name), task);
+    }
+
+    [[nodiscard]] auto compileArguments(const CompileTask &task) const -> std::vector<std::string>
+    {
+        std::vector<std::string> arguments;
+        addCompilerFlags(&arguments);
+        addModulePath(&arguments);
+        addIncludePaths(task, &arguments);
+        addCompileInputs(task, &arguments);
+        return arguments;
+    }
+
+    [[nodiscard]] auto executable(const Project *project) const -> std::filesystem::path
+    {
+#ifdef _WIN32
+        return mBuildRoot / "bin" / (project->name() + ".exe");
+#else
+        return mBuildRoot / "bin" / project->name();
+#endif
+    }
+
+    [[nodiscard]] auto headerUnitInput(const std::string &header, const std::filesystem::path &bmiPath) const -> std::string
+    {
+        if (isMSVC())
+        {
+            return header + '=' + bmiPath.string();
+        }
+        else
+        {
+            return bmiPath.string();
+        }
+    }
+
+    [[nodiscard]] auto isMSVC() const noexcept -> bool
+    {
+        return mToolchain.type == Toolchain::Type::MSVC;
+    }
+
+    [[nodiscard]] auto libraries(const LinkTask &task) const -> std::vector<std::filesystem::path>
+    {
+        std::vector<std::filesystem::path> result;
+        std::unordered_set<const BuildTask *> visited;
+        std::vector<const BuildTask *> stack{task.inputTasks.begin(), task.inputTasks.end()};
+
+        while (!stack.empty())
+        {
+            const BuildTask *input = stack.back();
+            stack.pop_back();
+
+            if (!visited.insert(input).second)
+            {
+                continue;
+            }
+
+            if (const auto *library = std::get_if<LinkLibraryTask>(input))
+            {
+                if (!objects(*library).empty())
+                {
+                    result.push_back(archive(library->project->name()));
+                }
+
+                stack.insert(stack.end(), library->inputTasks.begin(), library->inputTasks.end());
+            }
+            else if (const auto *moduleLibrary = std::get_if<LinkModuleLibraryTask>(input))
+            {
+                if (!objects(*moduleLibrary).empty())
+                {
+                    result.push_back(archive(moduleLibrary->mod->name));
+                }
+
+                stack.insert(stack.end(), moduleLibrary->inputTasks.begin(), moduleLibrary->inputTasks.end());
+            }
+        }
+
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    [[nodiscard]] auto moduleCommands(const CompileTask &task, const Source *source, const std::filesystem::path &bmiPath) const -> std::vector<Command>
+    {
+        std::vector<std::string> arguments = compileArguments(task);
+
+        if (isMSVC())
+        {
+            arguments.insert(arguments.end(), {"/interface", "/ifcOutput", bmiPath.string(), "/Fo" + object(source).string(), source->path().string()});
+            return {Command{.executable = mToolchain.compiler, .arguments = std::move(arguments)}};
+        }
+
+        std::vector<std::string> objectArguments = arguments;
+
+        if (mToolchain.type == Toolchain::Type::Clang)
+        {
+            arguments.insert(arguments.end(), {"-Xclang", "-emit-module-interface", source->path().string(), "-o", bmiPath.string()});
+        }
+        else
+        {
+            arguments.insert(arguments.end(), {"-fmodule-only", source->path().string()});
+        }
+
+        objectArguments.insert(objectArguments.end(), {source->path().string(), "-o", object(source).string()});
+        return {Command{.executable = mToolchain.compiler, .arguments = std::move(arguments)},
+                Command{.executable = mToolchain.compiler, .arguments = std::move(objectArguments)}};
+    }
+
+    [[nodiscard]] auto moduleMapperContent() const -> std::string
+    {
+        std::vector<std::string> lines;
+
+        for (const BuildTask *task : mBuildCache.buildTasks())
+        {
+            if (const auto *headerUnit = std::get_if<CompileHeaderUnitTask>(task))
+            {
+                lines.push_back(headerUnit->header->path().string() + ' ' + bmi(*headerUnit).string());
+            }
+            else if (const auto *stlHeaderUnit = std::get_if<CompileSTLHeaderUnitTask>(task))
+            {
+                if (const std::optional<std::filesystem::path> header = systemHeader(stlHeaderUnit->name))
+                {
+                    lines.push_back(header->string() + ' ' + bmi(*stlHeaderUnit).string());
+                }
+            }
+            else if (const auto *moduleInterface = std::get_if<CompileModuleInterfaceTask>(task))
+            {
+                lines.push_back(mBuildCache.cppModule(moduleInterface->source)->name + ' ' + bmi(*moduleInterface).string());
+            }
+            else if (const auto *modulePartition = std::get_if<CompileModulePartitionTask>(task))
+            {
+                const ModulePartition *partition = mBuildCache.cppModulePartition(modulePartition->source);
+                lines.push_back(partition->mod->name + ':' + partition->name + ' ' + bmi(*modulePartition).string());
+            }
+        }
+
+        std::sort(lines.begin(), lines.end());
+        std::string content;
+
+        for (const std::string &line : lines)
+        {
+            content += line + '\n';
+        }
+
+        return content;
+    }
+
+    [[nodiscard]] auto modulesDirectory() const -> std::filesystem::path
+    {
+        return mBuildRoot / "modules";
+    }
+
+    [[nodiscard]] auto object(const Source *source) const -> std::filesystem::path
+    {
+        std::filesystem::path path = mBuildRoot / "obj" / source->path().lexically_relative(mBuildCache.projectRoot());
+        path += isMSVC() ? ".obj" : ".o";
+        return path;
+    }
+
+    [[nodiscard]] auto objects(const LinkTask &task) const -> std::vector<std::string>
+    {
+        std::vector<std::string> result;
+
+        for (const BuildTask *input : task.inputTasks)
+        {
+            if (const auto *source = std::get_if<CompileSourceTask>(input))
+            {
+                result.push_back(object(source->source).string());
+            }
+            else if (const auto *moduleInterface = std::get_if<CompileModuleInterfaceTask>(input))
+            {
+                result.push_back(object(moduleInterface->source).string());
+            }
+            else if (const auto *partition = std::get_if<CompileModulePartitionTask>(input))
+            {
+                result.push_back(object(partition->source).string());
+            }
+        }
+
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    [[nodiscard]] auto outputs(const CompileHeaderUnitTask &task) const -> std::vector<std::filesystem::path>
+    {
+        return {bmi(task)};
+    }
+
+    [[nodiscard]] auto outputs(const CompileSTLHeaderUnitTask &task) const -> std::vector<std::filesystem::path>
+    {
+        return {bmi(task)};
+    }
+
+    [[nodiscard]] auto outputs(const CompileModuleInterfaceTask &task) const -> std::vector<std::filesystem::path>
+    {
+        return {bmi(task), object(task.source)};
+    }
+
+    [[nodiscard]] auto outputs(const CompileModulePartitionTask &task) const -> std::vector<std::filesystem::path>
+    {
+        return {bmi(task), object(task.source)};
+    }
+
+    [[nodiscard]] auto outputs(const CompileSourceTask &task) const -> std::vector<std::filesystem::path>
+    {
+        return {object(task.source)};
+    }
+
+    [[nodiscard]] auto outputs(const LinkExecutableTask &task) const -> std::vector<std::filesystem::path>
+    {
+        return {executable(task.project)};
+    }
+
+    [[nodiscard]] auto outputs(const LinkLibraryTask &task) const -> std::vector<std::filesystem::path>
+    {
+        if (objects(task).empty())
+        {
+            return {};
+        }
+
+        return {archive(task.project->name())};
+    }
+
+    [[nodiscard]] auto outputs(const LinkModuleLibraryTask &task) const -> std::vector<std::filesystem::path>
+    {
+        return {archive(task.mod->name)};
+    }
+
+    const BuildCache &mBuildCache;
+    const Toolchain &mToolchain;
+    std::filesystem::path mBuildRoot;
+};
+}
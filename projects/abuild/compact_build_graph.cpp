@@ -0,0 +1,184 @@
+#ifdef _MSC_VER
+export module abuild : compact_build_graph;
+export import : build_cache;
+#endif
+
+namespace abuild
+{
+export class CompactBuildGraph
+{
+public:
+    explicit CompactBuildGraph(const BuildCache &cache)
+    {
+        collectInputs(collectTasks(cache));
+        collectDependents();
+    }
+
+    [[nodiscard]] auto dependents(std::uint32_t task) const noexcept -> std::span<const std::uint32_t>
+    {
+        return edges(mDependents, mDependentOffsets, task);
+    }
+
+    [[nodiscard]] auto includePath(std::uint32_t id) const noexcept -> const std::filesystem::path &
+    {
+        return mPaths[id];
+    }
+
+    [[nodiscard]] auto includePaths(std::uint32_t task) const noexcept -> std::span<const std::uint32_t>
+    {
+        return edges(mIncludePaths, mIncludePathOffsets, task);
+    }
+
+    [[nodiscard]] auto inputs(std::uint32_t task) const noexcept -> std::span<const std::uint32_t>
+    {
+        return edges(mInputs, mInputOffsets, task);
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::uint32_t
+    {
+        return static_cast<std::uint32_t>(mTasks.size());
+    }
+
+    [[nodiscard]] auto task(std::uint32_t index) const noexcept -> BuildTask *
+    {
+        return mTasks[index];
+    }
+
+    template<typename T>
+    [[nodiscard]] auto tasks() const noexcept -> std::span<BuildTask *const>
+    {
+        constexpr std::size_t kind = kindIndex<T>();
+        return std::span<BuildTask *const>{mTasks.data() + mKindOffsets[kind], mTasks.data() + mKindOffsets[kind + 1]};
+    }
+
+private:
+    auto collectDependents() -> void
+    {
+        mDependentOffsets.assign(mTasks.size() + 1, 0);
+
+        for (std::uint32_t input : mInputs)
+        {
+            ++mDependentOffsets[input + 1];
+        }
+
+        std::partial_sum(mDependentOffsets.begin(), mDependentOffsets.end(), mDependentOffsets.begin());
+        std::vector<std::uint32_t> positions{mDependentOffsets.begin(), mDependentOffsets.end() - 1};
+        mDependents.resize(mInputs.size());
+
+        for (std::uint32_t task = 0; task < size(); ++task)
+        {
+            for (std::uint32_t input : inputs(task))
+            {
+                mDependents[positions[input]++] = task;
+            }
+        }
+    }
+
+    auto collectIncludePaths(const BuildTask &task, std::unordered_map<std::filesystem::path, std::uint32_t, PathHash> &ids) -> void
+    {
+        const std::size_t begin = mIncludePaths.size();
+
+        std::visit([&](auto &&value) {
+            if constexpr (std::is_base_of_v<CompileTask, std::decay_t<decltype(value)>>)
+            {
+                for (const std::filesystem::path &path : value.includePaths)
+                {
+                    const std::pair<std::unordered_map<std::filesystem::path, std::uint32_t, PathHash>::iterator, bool> result = ids.insert({path, static_cast<std::uint32_t>(mPaths.size())});
+
+                    if (result.second)
+                    {
+                        mPaths.push_back(path);
+                    }
+
+                    mIncludePaths.push_back(result.first->second);
+                }
+            }
+        },
+                   task);
+
+        std::sort(mIncludePaths.begin() + static_cast<std::ptrdiff_t>(begin), mIncludePaths.end());
+        mIncludePathOffsets.push_back(static_cast<std::uint32_t>(mIncludePaths.size()));
+    }
+
+    auto collectInputs(const std::unordered_map<const BuildTask *, std::uint32_t> &indexes) -> void
+    {
+        std::unordered_map<std::filesystem::path, std::uint32_t, PathHash> pathIds;
+        mInputOffsets.reserve(mTasks.size() + 1);
+        mInputOffsets.push_back(0);
+        mIncludePathOffsets.reserve(mTasks.size() + 1);
+        mIncludePathOffsets.push_back(0);
+
+        for (const BuildTask *task : mTasks)
+        {
+            const std::size_t begin = mInputs.size();
+
+            std::visit([&](auto &&value) {
+                for (const BuildTask *input : value.inputTasks)
+                {
+                    mInputs.push_back(indexes.at(input));
+                }
+            },
+                       *task);
+
+            std::sort(mInputs.begin() + static_cast<std::ptrdiff_t>(begin), mInputs.end());
+            mInputOffsets.push_back(static_cast<std::uint32_t>(mInputs.size()));
+            collectIncludePaths(*task, pathIds);
+        }
+    }
+
+    [[nodiscard]] auto collectTasks(const BuildCache &cache) -> std::unordered_map<const BuildTask *, std::uint32_t>
+    {
+        std::unordered_map<const BuildTask *, std::uint32_t> indexes;
+        indexes.reserve(cache.buildTasks().size());
+
+        for (BuildTask *task : cache.buildTasks())
+        {
+            ++mKindOffsets[task->index() + 1];
+        }
+
+        std::partial_sum(mKindOffsets.begin(), mKindOffsets.end(), mKindOffsets.begin());
+        std::array<std::uint32_t, KINDS> positions{};
+        std::copy(mKindOffsets.begin(), mKindOffsets.end() - 1, positions.begin());
+        mTasks.resize(cache.buildTasks().size());
+
+        for (BuildTask *task : cache.buildTasks())
+        {
+            const std::uint32_t index = positions[task->index()]++;
+            mTasks[index] = task;
+            indexes.insert({task, index});
+        }
+
+        return indexes;
+    }
+
+    [[nodiscard]] static auto edges(const std::vector<std::uint32_t> &values, const std::vector<std::uint32_t> &offsets, std::uint32_t task) noexcept -> std::span<const std::uint32_t>
+    {
+        return std::span<const std::uint32_t>{values.data() + offsets[task], values.data() + offsets[task + 1]};
+    }
+
+    template<typename T, std::size_t Kind = 0>
+    [[nodiscard]] static constexpr auto kindIndex() noexcept -> std::size_t
+    {
+        if constexpr (std::is_same_v<std::variant_alternative_t<Kind, BuildTask>, T>)
+        {
+            return Kind;
+        }
+        else
+        {
+            return kindIndex<T, Kind + 1>();
+        }
+    }
+
+    static constexpr std::size_t KINDS = std::variant_size_v<BuildTask>;
+
+    std::vector<BuildTask *> mTasks;
+    std::array<std::uint32_t, KINDS + 1> mKindOffsets{};
+    std::vector<std::uint32_t> mInputOffsets;
+    std::vector<std::uint32_t> mInputs;
+    std::vector<std::uint32_t> mDependentOffsets;
+    std::vector<std::uint32_t> mDependents;
+    std::vector<std::uint32_t> mIncludePathOffsets;
+    std::vector<std::uint32_t> mIncludePaths;
+    std::vector<std::filesystem::path> mPaths;
+};
+}
@@ -11,9 +11,21 @@ public:
     explicit DependencyScanner(BuildCache &cache) :
         mBuildCache{cache}
     {
+        const TraceSpan span{mBuildCache.trace(), "DependencyScanner", "DependencyScanner"};
         scan();
     }
 
+    DependencyScanner(BuildCache &cache, const std::vector<File *> &files) :
+        mBuildCache{cache}
+    {
+        const TraceSpan span{mBuildCache.trace(), "DependencyScanner", "DependencyScanner"};
+
+        for (File *file : files)
+        {
+            scanFile(file);
+        }
+    }
+
 private:
     [[nodiscard]] auto moduleFromFile(File *file) -> Module *
     {
@@ -47,14 +59,14 @@ private:
 
     auto scan() -> void
     {
-        for (const std::unique_ptr<Source> &source : mBuildCache.sources())
+        for (Source *source : mBuildCache.sources())
         {
-            scanFile(source.get());
+            scanFile(source);
         }
 
-        for (const std::unique_ptr<Header> &header : mBuildCache.headers())
+        for (Header *header : mBuildCache.headers())
         {
-            scanFile(header.get());
+            scanFile(header);
         }
     }
 
@@ -76,14 +88,14 @@ private:
 
         if (auto *value = std::get_if<IncludeLocalHeaderDependency>(dependency))
         {
-            value->header = mBuildCache.header(value->name, file->path().parent_path());
+            value->header = mBuildCache.header(value->name, file);
             validateHeader(value->header, value->name, file);
             return;
         }
 
         if (auto *value = std::get_if<IncludeLocalSourceDependency>(dependency))
         {
-            value->source = mBuildCache.source(value->name, file->path().parent_path());
+            value->source = mBuildCache.source(value->name, file);
             validateSource(value->source, value->name, file);
             return;
         }
@@ -97,7 +109,7 @@ private:
 
         if (auto *value = std::get_if<ImportLocalHeaderDependency>(dependency))
         {
-            value->header = mBuildCache.header(value->name, file->path().parent_path());
+            value->header = mBuildCache.header(value->name, file);
             validateHeader(value->header, value->name, file);
             return;
         }
@@ -0,0 +1,28 @@
+#ifdef _MSC_VER
+export module abuild : directory_watcher;
+import : directory_watcher_windows;
+#endif
+
+namespace abuild
+{
+export class DirectoryWatcher
+{
+public:
+    [[nodiscard]] auto wait(std::chrono::milliseconds timeout) -> std::vector<std::filesystem::path>
+    {
+        return mWatcher.wait(timeout);
+    }
+
+    auto watch(const std::filesystem::path &directory) -> void
+    {
+        mWatcher.watch(directory);
+    }
+
+private:
+#ifdef _MSC_VER
+    DirectoryWatcherWindows mWatcher;
+#else
+    DirectoryWatcherUnix mWatcher;
+#endif
+};
+}
@@ -0,0 +1,117 @@
+// clang-format off
+import <poll.h>;
+import <sys/inotify.h>;
+import <unistd.h>;
+// clang-format on
+
+namespace abuild
+{
+class DirectoryWatcherUnix
+{
+public:
+    DirectoryWatcherUnix() :
+        mHandle{inotify_init1(IN_CLOEXEC | IN_NONBLOCK)}
+    {
+        if (mHandle == -1)
+        {
+            throw std::runtime_error{"Failed to initialize inotify."};
+        }
+    }
+
+    DirectoryWatcherUnix(const DirectoryWatcherUnix &other) = delete;
+    DirectoryWatcherUnix(DirectoryWatcherUnix &&other) noexcept = delete;
+
+    ~DirectoryWatcherUnix()
+    {
+        close(mHandle);
+    }
+
+    [[nodiscard]] auto wait(std::chrono::milliseconds timeout) -> std::vector<std::filesystem::path>
+    {
+        std::vector<std::filesystem::path> changes;
+        pollfd request{.fd = mHandle, .events = POLLIN, .revents = 0};
+
+        if (poll(&request, 1, static_cast<int>(timeout.count())) <= 0)
+        {
+            return changes;
+        }
+
+        alignas(inotify_event) char buffer[EVENT_BUFFER_SIZE];
+
+        for (ssize_t size = read(mHandle, buffer, sizeof(buffer)); size > 0; size = read(mHandle, buffer, sizeof(buffer)))
+        {
+            for (ssize_t pos = 0; pos < size;)
+            {
+                const auto *event = reinterpret_cast<const inotify_event *>(buffer + pos);
+                pos += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+                addChange(*event, &changes);
+            }
+        }
+
+        return changes;
+    }
+
+    auto watch(const std::filesystem::path &directory) -> void
+    {
+        const int descriptor = inotify_add_watch(mHandle, directory.c_str(), WATCH_MASK);
+
+        if (descriptor == -1)
+        {
+            throw std::runtime_error{"Failed to watch directory '" + directory.string() + "'."};
+        }
+
+        if (mDirectories.empty())
+        {
+            mRoot = directory;
+        }
+
+        mDirectories[descriptor] = directory;
+    }
+
+    auto operator=(const DirectoryWatcherUnix &other) -> DirectoryWatcherUnix & = delete;
+    auto operator=(DirectoryWatcherUnix &&other) noexcept -> DirectoryWatcherUnix & = delete;
+
+private:
+    auto addChange(const inotify_event &event, std::vector<std::filesystem::path> *changes) const -> void
+    {
+        if ((event.mask & IN_Q_OVERFLOW) != 0)
+        {
+            changes->push_back(mRoot);
+            return;
+        }
+
+        if ((event.mask & IN_IGNORED) != 0)
+        {
+            return;
+        }
+
+        if ((event.mask & IN_ATTRIB) != 0 && ((event.mask & IN_ISDIR) != 0 || event.len == 0))
+        {
+            return;
+        }
+
+        std::unordered_map<int, std::filesystem::path>::const_iterator it = mDirectories.find(event.wd);
+
+        if (it == mDirectories.end())
+        {
+            return;
+        }
+
+        if (event.len == 0)
+        {
+            changes->push_back(it->second);
+        }
+        else
+        {
+            changes->push_back(it->second / event.name);
+        }
+    }
+
+    static constexpr std::size_t EVENT_BUFFER_SIZE = 65536;
+    static constexpr std::uint32_t WATCH_MASK = IN_ATTRIB | IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_DELETE_SELF | IN_MOVE_SELF | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+
+    int mHandle = -1;
+    std::filesystem::path mRoot;
+    std::unordered_map<int, std::filesystem::path> mDirectories;
+};
+}
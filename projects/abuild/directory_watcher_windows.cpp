@@ -0,0 +1,146 @@
+module;
+
+#pragma warning(push)
+#pragma warning(disable : 5105)
+#pragma warning(disable : 5106)
+#pragma warning(disable : 4005)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+module abuild : directory_watcher_windows;
+
+import<astl.hpp>;
+#pragma warning(pop)
+
+namespace abuild
+{
+class DirectoryWatcherWindows
+{
+public:
+    DirectoryWatcherWindows() = default;
+    DirectoryWatcherWindows(const DirectoryWatcherWindows &other) = delete;
+    DirectoryWatcherWindows(DirectoryWatcherWindows &&other) noexcept = delete;
+
+    ~DirectoryWatcherWindows()
+    {
+        for (const std::unique_ptr<Directory> &directory : mDirectories)
+        {
+            CancelIo(directory->handle);
+            CloseHandle(directory->handle);
+            CloseHandle(directory->overlapped.hEvent);
+        }
+    }
+
+    [[nodiscard]] auto wait(std::chrono::milliseconds timeout) -> std::vector<std::filesystem::path>
+    {
+        std::vector<std::filesystem::path> changes;
+        std::vector<HANDLE> events;
+
+        for (const std::unique_ptr<Directory> &directory : mDirectories)
+        {
+            events.push_back(directory->overlapped.hEvent);
+        }
+
+        if (events.empty() || WaitForMultipleObjects(static_cast<DWORD>(events.size()), events.data(), FALSE, static_cast<DWORD>(timeout.count())) >= WAIT_OBJECT_0 + events.size())
+        {
+            return changes;
+        }
+
+        for (const std::unique_ptr<Directory> &directory : mDirectories)
+        {
+            if (WaitForSingleObject(directory->overlapped.hEvent, 0) == WAIT_OBJECT_0)
+            {
+                addChanges(*directory, &changes);
+                listen(*directory);
+            }
+        }
+
+        return changes;
+    }
+
+    auto watch(const std::filesystem::path &directory) -> void
+    {
+        for (const std::unique_ptr<Directory> &watched : mDirectories)
+        {
+            if (isWithin(directory, watched->path))
+            {
+                return;
+            }
+        }
+
+        if (mDirectories.size() == MAXIMUM_WAIT_OBJECTS)
+        {
+            throw std::runtime_error{"Failed to watch directory '" + directory.string() + "': too many watched directories."};
+        }
+
+        auto watched = std::make_unique<Directory>();
+        watched->path = directory;
+        watched->handle = CreateFileW(directory.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+
+        if (watched->handle == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error{"Failed to watch directory '" + directory.string() + "'."};
+        }
+
+        watched->overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        listen(*watched);
+        mDirectories.push_back(std::move(watched));
+    }
+
+    auto operator=(const DirectoryWatcherWindows &other) -> DirectoryWatcherWindows & = delete;
+    auto operator=(DirectoryWatcherWindows &&other) noexcept -> DirectoryWatcherWindows & = delete;
+
+private:
+    struct Directory
+    {
+        std::filesystem::path path;
+        HANDLE handle = INVALID_HANDLE_VALUE;
+        OVERLAPPED overlapped = {};
+        alignas(DWORD) std::array<char, 65536> buffer = {};
+    };
+
+    static auto addChanges(Directory &directory, std::vector<std::filesystem::path> *changes) -> void
+    {
+        DWORD size = 0;
+
+        if (GetOverlappedResult(directory.handle, &directory.overlapped, &size, FALSE) == 0 || size == 0)
+        {
+            changes->push_back(directory.path);
+            return;
+        }
+
+        for (DWORD pos = 0;;)
+        {
+            const auto *info = reinterpret_cast<const FILE_NOTIFY_INFORMATION *>(directory.buffer.data() + pos);
+            changes->push_back(directory.path / std::wstring{info->FileName, info->FileNameLength / sizeof(wchar_t)});
+
+            if (info->NextEntryOffset == 0)
+            {
+                break;
+            }
+
+            pos += info->NextEntryOffset;
+        }
+    }
+
+    [[nodiscard]] static auto isWithin(const std::filesystem::path &path, const std::filesystem::path &directory) -> bool
+    {
+        const std::filesystem::path relative = path.lexically_relative(directory);
+        return !relative.empty() && *relative.begin() != "..";
+    }
+
+    static auto listen(Directory &directory) -> void
+    {
+        ResetEvent(directory.overlapped.hEvent);
+
+        if (ReadDirectoryChangesW(directory.handle, directory.buffer.data(), static_cast<DWORD>(directory.buffer.size()), TRUE, WATCH_FILTER, nullptr, &directory.overlapped, nullptr) == 0)
+        {
+            throw std::runtime_error{"Failed to watch directory '" + directory.path.string() + "'."};
+        }
+    }
+
+    static constexpr DWORD WATCH_FILTER = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+
+    std::vector<std::unique_ptr<Directory>> mDirectories;
+};
+}
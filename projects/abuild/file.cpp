@@ -1,6 +1,10 @@
 #ifdef _MSC_VER
 export module abuild : file;
+export import : arena;
 export import : dependency;
+export import : file_view;
+export import : file_status;
+import : file_status_windows;
 #endif
 
 namespace abuild
@@ -10,15 +14,16 @@ export class Project;
 export class File
 {
 public:
-    File(const std::filesystem::path &path, Project *project) :
-        File{path, project, lastModified(path)}
+    File(const std::filesystem::path &path, Project *project, std::pmr::memory_resource *resource = std::pmr::get_default_resource()) :
+        File{std::filesystem::canonical(path), project, fileStatus(path), resource}
     {
     }
 
-    File(const std::filesystem::path &path, Project *project, std::int64_t timestamp) :
-        mPath{std::filesystem::canonical(path)},
+    File(std::filesystem::path path, Project *project, FileStatus status, std::pmr::memory_resource *resource = std::pmr::get_default_resource()) :
+        mPath{std::move(path)},
         mProject{project},
-        mTimestamp{timestamp}
+        mStatus{status},
+        mDependencies{resource}
     {
     }
 
@@ -27,20 +32,17 @@ public:
         mDependencies.push_back(std::move(dependency));
     }
 
-    [[nodiscard]] auto content() const noexcept -> std::string
+    [[nodiscard]] auto content() const -> std::string
     {
-        std::ifstream file{mPath};
-        std::string data;
-
-        file.seekg(0, std::ios::end);
-        data.reserve(file.tellg());
-        file.seekg(0, std::ios::beg);
-        data.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+        return std::string{view().content()};
+    }
 
-        return data;
+    [[nodiscard]] auto contentHash() const noexcept -> const Digest &
+    {
+        return mContentHash;
     }
 
-    [[nodiscard]] auto dependencies() noexcept -> std::vector<Dependency> &
+    [[nodiscard]] auto dependencies() noexcept -> ArenaVector<Dependency> &
     {
         return mDependencies;
     }
@@ -52,7 +54,12 @@ public:
 
     [[nodiscard]] auto isModified() const -> bool
     {
-        return timestamp() != lastModified(mPath);
+        return isModified(fileStatus(mPath));
+    }
+
+    [[nodiscard]] auto isModified(const FileStatus &status) const noexcept -> bool
+    {
+        return mStatus != status;
     }
 
     [[nodiscard]] auto name() const -> std::string
@@ -75,25 +82,36 @@ public:
         return mProject;
     }
 
+    [[nodiscard]] auto status() const noexcept -> const FileStatus &
+    {
+        return mStatus;
+    }
+
     [[nodiscard]] auto timestamp() const noexcept -> std::int64_t
     {
-        return mTimestamp;
+        return mStatus.timestamp;
+    }
+
+    auto setContentHash(const Digest &hash) noexcept -> void
+    {
+        mContentHash = hash;
     }
 
     auto update() -> void
     {
-        mTimestamp = lastModified(mPath);
+        mStatus = fileStatus(mPath);
     }
 
-private:
-    [[nodiscard]] static auto lastModified(const std::filesystem::path &path) -> std::int64_t
+    [[nodiscard]] auto view() const -> FileView
     {
-        return std::chrono::duration_cast<std::chrono::seconds>(std::filesystem::last_write_time(path).time_since_epoch()).count();
+        return FileView{mPath};
     }
 
+private:
     std::filesystem::path mPath;
     Project *mProject = nullptr;
-    std::int64_t mTimestamp = 0;
-    std::vector<Dependency> mDependencies;
+    FileStatus mStatus;
+    Digest mContentHash;
+    ArenaVector<Dependency> mDependencies;
 };
 }
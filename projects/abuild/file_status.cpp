@@ -0,0 +1,17 @@
+#ifdef _MSC_VER
+export module abuild : file_status;
+export import<astl.hpp>;
+#endif
+
+namespace abuild
+{
+export struct FileStatus
+{
+    std::int64_t timestamp = 0;
+    std::uint64_t size = 0;
+    std::uint64_t device = 0;
+    std::uint64_t inode = 0;
+
+    [[nodiscard]] auto operator==(const FileStatus &other) const noexcept -> bool = default;
+};
+}
@@ -0,0 +1,22 @@
+// clang-format off
+import <sys/stat.h>;
+// clang-format on
+
+namespace abuild
+{
+[[nodiscard]] auto fileStatus(const std::filesystem::path &path) -> FileStatus
+{
+    struct stat info = {};
+
+    if (::stat(path.c_str(), &info) != 0)
+    {
+        throw std::filesystem::filesystem_error{"Failed to read status of file", path, std::error_code{errno, std::generic_category()}};
+    }
+
+    return FileStatus{
+        .timestamp = static_cast<std::int64_t>(info.st_mtim.tv_sec) * 1000000000 + static_cast<std::int64_t>(info.st_mtim.tv_nsec),
+        .size = static_cast<std::uint64_t>(info.st_size),
+        .device = static_cast<std::uint64_t>(info.st_dev),
+        .inode = static_cast<std::uint64_t>(info.st_ino)};
+}
+}
@@ -0,0 +1,31 @@
+module;
+
+#pragma warning(push)
+#pragma warning(disable : 5105)
+#pragma warning(disable : 5106)
+#pragma warning(disable : 4005)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+module abuild : file_status_windows;
+
+import<astl.hpp>;
+import : file_status;
+#pragma warning(pop)
+
+namespace abuild
+{
+[[nodiscard]] auto fileStatus(const std::filesystem::path &path) -> FileStatus
+{
+    WIN32_FILE_ATTRIBUTE_DATA info = {};
+
+    if (GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &info) == 0)
+    {
+        throw std::filesystem::filesystem_error{"Failed to read status of file", path, std::error_code{static_cast<int>(GetLastError()), std::system_category()}};
+    }
+
+    return FileStatus{
+        .timestamp = static_cast<std::int64_t>((static_cast<std::uint64_t>(info.ftLastWriteTime.dwHighDateTime) << 32) | info.ftLastWriteTime.dwLowDateTime),
+        .size = (static_cast<std::uint64_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow};
+}
+}
@@ -0,0 +1,36 @@
+#ifdef _MSC_VER
+export module abuild : file_view;
+export import : fingerprint;
+import : file_view_windows;
+#endif
+
+namespace abuild
+{
+export class FileView
+{
+public:
+    explicit FileView(const std::filesystem::path &path) :
+        mView{path, MAPPING_THRESHOLD}
+    {
+    }
+
+    [[nodiscard]] auto content() const noexcept -> std::string_view
+    {
+        return mView.content();
+    }
+
+    [[nodiscard]] auto hash() const noexcept -> Digest
+    {
+        return Fingerprint{}.add(content()).value();
+    }
+
+private:
+    static constexpr std::size_t MAPPING_THRESHOLD = 16384;
+
+#ifdef _MSC_VER
+    FileViewWindows mView;
+#else
+    FileViewUnix mView;
+#endif
+};
+}
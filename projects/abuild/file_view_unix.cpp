@@ -0,0 +1,106 @@
+// clang-format off
+import <fcntl.h>;
+import <sys/mman.h>;
+import <sys/stat.h>;
+import <unistd.h>;
+// clang-format on
+
+namespace abuild
+{
+class FileViewUnix
+{
+public:
+    FileViewUnix(const std::filesystem::path &path, std::size_t mappingThreshold)
+    {
+        const int file = open(path.c_str(), O_RDONLY);
+
+        if (file == -1)
+        {
+            throw std::runtime_error{"Failed to open file '" + path.string() + "'."};
+        }
+
+        struct stat status = {};
+
+        if (fstat(file, &status) != 0)
+        {
+            close(file);
+            throw std::runtime_error{"Failed to read attributes of file '" + path.string() + "'."};
+        }
+
+        const auto size = static_cast<std::size_t>(status.st_size);
+
+        if (size < mappingThreshold || !mapFile(file, size))
+        {
+            readFile(file, size);
+        }
+
+        close(file);
+    }
+
+    FileViewUnix(const FileViewUnix &other) = delete;
+    FileViewUnix(FileViewUnix &&other) noexcept = delete;
+
+    ~FileViewUnix()
+    {
+        if (mData != nullptr)
+        {
+            munmap(mData, mSize);
+        }
+    }
+
+    [[nodiscard]] auto content() const noexcept -> std::string_view
+    {
+        if (mData != nullptr)
+        {
+            return std::string_view{static_cast<const char *>(mData), mSize};
+        }
+        else
+        {
+            return mBuffer;
+        }
+    }
+
+    auto operator=(const FileViewUnix &other) -> FileViewUnix & = delete;
+    auto operator=(FileViewUnix &&other) noexcept -> FileViewUnix & = delete;
+
+private:
+    [[nodiscard]] auto mapFile(int file, std::size_t size) -> bool
+    {
+        void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        madvise(data, size, MADV_SEQUENTIAL);
+        mData = data;
+        mSize = size;
+        return true;
+    }
+
+    auto readFile(int file, std::size_t size) -> void
+    {
+        mBuffer.resize(size);
+        std::size_t offset = 0;
+
+        while (offset < size)
+        {
+            const ssize_t bytesRead = read(file, mBuffer.data() + offset, size - offset);
+
+            if (bytesRead <= 0)
+            {
+                break;
+            }
+
+            offset += static_cast<std::size_t>(bytesRead);
+        }
+
+        mBuffer.resize(offset);
+    }
+
+    void *mData = nullptr;
+    std::size_t mSize = 0;
+    std::string mBuffer;
+};
+}
@@ -0,0 +1,120 @@
+module;
+
+#pragma warning(push)
+#pragma warning(disable : 5105)
+#pragma warning(disable : 5106)
+#pragma warning(disable : 4005)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+module abuild : file_view_windows;
+
+import<astl.hpp>;
+#pragma warning(pop)
+
+namespace abuild
+{
+class FileViewWindows
+{
+public:
+    FileViewWindows(const std::filesystem::path &path, std::size_t mappingThreshold)
+    {
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error{"Failed to open file '" + path.string() + "'."};
+        }
+
+        LARGE_INTEGER fileSize = {};
+
+        if (GetFileSizeEx(file, &fileSize) == 0)
+        {
+            CloseHandle(file);
+            throw std::runtime_error{"Failed to read attributes of file '" + path.string() + "'."};
+        }
+
+        const auto size = static_cast<std::size_t>(fileSize.QuadPart);
+
+        if (size < mappingThreshold || !mapFile(file, size))
+        {
+            readFile(file, size);
+        }
+
+        CloseHandle(file);
+    }
+
+    FileViewWindows(const FileViewWindows &other) = delete;
+    FileViewWindows(FileViewWindows &&other) noexcept = delete;
+
+    ~FileViewWindows()
+    {
+        if (mData != nullptr)
+        {
+            UnmapViewOfFile(mData);
+        }
+    }
+
+    [[nodiscard]] auto content() const noexcept -> std::string_view
+    {
+        if (mData != nullptr)
+        {
+            return std::string_view{static_cast<const char *>(mData), mSize};
+        }
+        else
+        {
+            return mBuffer;
+        }
+    }
+
+    auto operator=(const FileViewWindows &other) -> FileViewWindows & = delete;
+    auto operator=(FileViewWindows &&other) noexcept -> FileViewWindows & = delete;
+
+private:
+    [[nodiscard]] auto mapFile(HANDLE file, std::size_t size) -> bool
+    {
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+
+        if (data == nullptr)
+        {
+            return false;
+        }
+
+        mData = data;
+        mSize = size;
+        return true;
+    }
+
+    auto readFile(HANDLE file, std::size_t size) -> void
+    {
+        mBuffer.resize(size);
+        std::size_t offset = 0;
+
+        while (offset < size)
+        {
+            DWORD bytesRead = 0;
+
+            if (ReadFile(file, mBuffer.data() + offset, static_cast<DWORD>(std::min<std::size_t>(size - offset, MAXDWORD)), &bytesRead, nullptr) == 0 || bytesRead == 0)
+            {
+                break;
+            }
+
+            offset += bytesRead;
+        }
+
+        mBuffer.resize(offset);
+    }
+
+    void *mData = nullptr;
+    std::size_t mSize = 0;
+    std::string mBuffer;
+};
+}
@@ -0,0 +1,180 @@
+#ifdef _MSC_VER
+export module abuild : fingerprint;
+export import<astl.hpp>;
+#endif
+
+namespace abuild
+{
+export struct Digest
+{
+    std::uint64_t low = 0;
+    std::uint64_t high = 0;
+
+    [[nodiscard]] auto operator==(const Digest &other) const noexcept -> bool = default;
+    [[nodiscard]] auto operator<=>(const Digest &other) const noexcept -> std::strong_ordering = default;
+};
+
+export class Fingerprint
+{
+public:
+    Fingerprint() noexcept :
+        mState{IV}
+    {
+        mState[0] ^= PARAMETERS;
+    }
+
+    auto add(std::string_view data) noexcept -> Fingerprint &
+    {
+        add(static_cast<std::uint64_t>(data.size()));
+        update(data);
+        return *this;
+    }
+
+    auto add(std::uint64_t value) noexcept -> Fingerprint &
+    {
+        char bytes[sizeof(std::uint64_t)];
+
+        for (std::size_t i = 0; i < sizeof(bytes); ++i)
+        {
+            bytes[i] = static_cast<char>(value >> (i * 8));
+        }
+
+        update(std::string_view{bytes, sizeof(bytes)});
+        return *this;
+    }
+
+    auto add(const Digest &digest) noexcept -> Fingerprint &
+    {
+        return add(digest.low).add(digest.high);
+    }
+
+    [[nodiscard]] auto hex() const -> std::string
+    {
+        static constexpr char DIGITS[] = "0123456789abcdef";
+        const Digest digest = value();
+        std::string result;
+        result.reserve(32);
+
+        for (std::uint64_t lane : {digest.low, digest.high})
+        {
+            for (int shift = 0; shift < 64; shift += 8)
+            {
+                result.push_back(DIGITS[(lane >> (shift + 4)) & 0xf]);
+                result.push_back(DIGITS[(lane >> shift) & 0xf]);
+            }
+        }
+
+        return result;
+    }
+
+    [[nodiscard]] auto value() const noexcept -> Digest
+    {
+        std::array<std::uint64_t, 8> state = mState;
+        std::array<char, BLOCK_SIZE> block{};
+        std::memcpy(block.data(), mBlock.data(), mBlockSize);
+        compress(&state, block.data(), mCounter + mBlockSize, true);
+        return Digest{.low = state[0], .high = state[1]};
+    }
+
+private:
+    static constexpr std::size_t BLOCK_SIZE = 128;
+    static constexpr std::uint64_t PARAMETERS = 0x01010000 | 16;
+    static constexpr std::array<std::uint64_t, 8> IV{
+        0x6a09e667f3bcc908,
+        0xbb67ae8584caa73b,
+        0x3c6ef372fe94f82b,
+        0xa54ff53a5f1d36f1,
+        0x510e527fade682d1,
+        0x9b05688c2b3e6c1f,
+        0x1f83d9abfb41bd6b,
+        0x5be0cd19137e2179};
+    static constexpr std::uint8_t SIGMA[12][16]{
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+        {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+        {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+        {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+        {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+        {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+        {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+        {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+        {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3}};
+
+    static auto compress(std::array<std::uint64_t, 8> *state, const char *block, std::uint64_t counter, bool last) noexcept -> void
+    {
+        std::uint64_t message[16];
+        std::memcpy(message, block, BLOCK_SIZE);
+
+        std::uint64_t v[16];
+        std::copy(state->begin(), state->end(), v);
+        std::copy(IV.begin(), IV.end(), v + 8);
+        v[12] ^= counter;
+
+        if (last)
+        {
+            v[14] = ~v[14];
+        }
+
+        const auto mix = [&](int a, int b, int c, int d, std::uint64_t x, std::uint64_t y) {
+            v[a] = v[a] + v[b] + x;
+            v[d] = std::rotr(v[d] ^ v[a], 32);
+            v[c] = v[c] + v[d];
+            v[b] = std::rotr(v[b] ^ v[c], 24);
+            v[a] = v[a] + v[b] + y;
+            v[d] = std::rotr(v[d] ^ v[a], 16);
+            v[c] = v[c] + v[d];
+            v[b] = std::rotr(v[b] ^ v[c], 63);
+        };
+
+        for (const std::uint8_t(&sigma)[16] : SIGMA)
+        {
+            mix(0, 4, 8, 12, message[sigma[0]], message[sigma[1]]);
+            mix(1, 5, 9, 13, message[sigma[2]], message[sigma[3]]);
+            mix(2, 6, 10, 14, message[sigma[4]], message[sigma[5]]);
+            mix(3, 7, 11, 15, message[sigma[6]], message[sigma[7]]);
+            mix(0, 5, 10, 15, message[sigma[8]], message[sigma[9]]);
+            mix(1, 6, 11, 12, message[sigma[10]], message[sigma[11]]);
+            mix(2, 7, 8, 13, message[sigma[12]], message[sigma[13]]);
+            mix(3, 4, 9, 14, message[sigma[14]], message[sigma[15]]);
+        }
+
+        for (std::size_t i = 0; i < state->size(); ++i)
+        {
+            (*state)[i] ^= v[i] ^ v[i + 8];
+        }
+    }
+
+    auto update(std::string_view data) noexcept -> void
+    {
+        while (!data.empty())
+        {
+            if (mBlockSize == BLOCK_SIZE)
+            {
+                mCounter += BLOCK_SIZE;
+                compress(&mState, mBlock.data(), mCounter, false);
+                mBlockSize = 0;
+            }
+
+            if (mBlockSize == 0 && data.size() > BLOCK_SIZE)
+            {
+                mCounter += BLOCK_SIZE;
+                compress(&mState, data.data(), mCounter, false);
+                data.remove_prefix(BLOCK_SIZE);
+                continue;
+            }
+
+            const std::size_t size = std::min(BLOCK_SIZE - mBlockSize, data.size());
+            std::memcpy(mBlock.data() + mBlockSize, data.data(), size);
+            mBlockSize += size;
+            data.remove_prefix(size);
+        }
+    }
+
+    std::array<std::uint64_t, 8> mState;
+    std::array<char, BLOCK_SIZE> mBlock{};
+    std::size_t mBlockSize = 0;
+    std::uint64_t mCounter = 0;
+};
+}
@@ -0,0 +1,435 @@
+#ifdef _MSC_VER
+export module abuild : header_unit_prebuilder;
+export import : build_cache;
+import : build_executor;
+import : build_graph;
+#endif
+
+namespace abuild
+{
+export class HeaderUnitPrebuilder
+{
+public:
+    HeaderUnitPrebuilder(BuildCache &cache, const Toolchain &toolchain) :
+        HeaderUnitPrebuilder{cache, toolchain, std::thread::hardware_concurrency()}
+    {
+    }
+
+    HeaderUnitPrebuilder(BuildCache &cache, const Toolchain &toolchain, std::size_t threads) :
+        mBuildCache{cache},
+        mToolchain{toolchain},
+        mThreads{threads},
+        mStates{cache.taskStates()},
+        mThread{[this] { work(); }}
+    {
+    }
+
+    HeaderUnitPrebuilder(const HeaderUnitPrebuilder &other) = delete;
+    HeaderUnitPrebuilder(HeaderUnitPrebuilder &&other) noexcept = delete;
+
+    ~HeaderUnitPrebuilder()
+    {
+        finish();
+    }
+
+    auto add(const std::string &name) -> void
+    {
+        {
+            std::scoped_lock lock{mMutex};
+            addName(name);
+        }
+
+        mWorkAvailable.notify_one();
+    }
+
+    auto add(File *file) -> void
+    {
+        {
+            std::scoped_lock lock{mMutex};
+            mScanned.insert(file);
+            const std::vector<File *> &files = resolved(file);
+
+            for (std::size_t i = 0; i < files.size(); ++i)
+            {
+                const Dependency &dependency = file->dependencies()[i];
+
+                if (const auto *dep = std::get_if<ImportSTLHeaderDependency>(&dependency))
+                {
+                    addName(dep->name);
+                }
+                else if (files[i] && isHeaderImport(dependency) && mImported.insert(files[i]).second)
+                {
+                    mCandidates.push_back(files[i]);
+                }
+            }
+
+            dispatchCandidates();
+        }
+
+        mWorkAvailable.notify_one();
+    }
+
+    [[nodiscard]] auto dispatchedTasks() -> std::size_t
+    {
+        std::scoped_lock lock{mMutex};
+        return mNames.size() + mDispatchedHeaderUnits;
+    }
+
+    auto finish() -> void
+    {
+        if (!mThread.joinable())
+        {
+            return;
+        }
+
+        {
+            std::scoped_lock lock{mMutex};
+            mStopping = true;
+        }
+
+        mWorkAvailable.notify_one();
+        mThread.join();
+
+        std::unordered_map<std::string, std::chrono::milliseconds> durations = mBuildCache.taskDurations();
+
+        for (std::pair<const std::string, std::chrono::milliseconds> &duration : mDurations)
+        {
+            durations.insert_or_assign(duration.first, duration.second);
+        }
+
+        mBuildCache.setTaskDurations(std::move(durations));
+        mBuildCache.setTaskStates(std::move(mStates));
+
+        for (Error &error : mErrors)
+        {
+            mBuildCache.addError(std::move(error));
+        }
+    }
+
+private:
+    enum class Closure
+    {
+        Complete,
+        Incomplete,
+        Unsupported
+    };
+
+    struct Snapshot
+    {
+        std::filesystem::path path;
+        std::string project;
+        Digest contentHash;
+        std::vector<Dependency> dependencies;
+        std::vector<File *> files;
+        bool source = false;
+    };
+
+    struct HeaderUnit
+    {
+        const File *header = nullptr;
+        std::vector<std::pair<const File *, const Snapshot *>> files;
+    };
+
+    [[nodiscard]] static auto addHeaderUnits(BuildCache &cache, const std::vector<HeaderUnit> &units) -> std::vector<Header *>
+    {
+        std::unordered_map<const File *, File *> files;
+        std::vector<std::pair<const Snapshot *, File *>> copies;
+
+        for (const HeaderUnit &unit : units)
+        {
+            for (const std::pair<const File *, const Snapshot *> &file : unit.files)
+            {
+                if (!files.contains(file.first))
+                {
+                    File *copy = file.second->source ? static_cast<File *>(cache.addSource(file.second->path, file.second->project)) : cache.addHeader(file.second->path, file.second->project);
+                    copy->setContentHash(file.second->contentHash);
+                    files.insert({file.first, copy});
+                    copies.emplace_back(file.second, copy);
+                }
+            }
+        }
+
+        for (const std::pair<const Snapshot *, File *> &copy : copies)
+        {
+            for (std::size_t i = 0; i < copy.first->dependencies.size(); ++i)
+            {
+                Dependency dependency = copy.first->dependencies[i];
+                link(&dependency, copy.first->files[i] ? files.at(copy.first->files[i]) : nullptr);
+                copy.second->addDependency(std::move(dependency));
+            }
+        }
+
+        std::vector<Header *> headers;
+
+        for (const HeaderUnit &unit : units)
+        {
+            headers.push_back(static_cast<Header *>(files.at(unit.header)));
+        }
+
+        return headers;
+    }
+
+    auto addName(const std::string &name) -> void
+    {
+        if (mNames.insert(name).second)
+        {
+            mPendingNames.push_back(name);
+        }
+    }
+
+    auto build(const std::vector<std::string> &names, const std::vector<HeaderUnit> &units) -> void
+    {
+        BuildCache cache{mBuildCache.projectRoot()};
+        std::unordered_map<std::string, TaskState> states;
+
+        for (const std::string &name : names)
+        {
+            cache.addBuildTask(name.c_str(), CompileSTLHeaderUnitTask{.name = name});
+        }
+
+        BuildGraph{cache, addHeaderUnits(cache, units)};
+
+        for (const BuildTask *task : cache.buildTasks())
+        {
+            if (std::unordered_map<std::string, TaskState>::const_iterator it = mStates.find(cache.taskName(*task)); it != mStates.end())
+            {
+                states.insert(*it);
+            }
+        }
+
+        cache.setTaskStates(std::move(states));
+
+        {
+            const BuildExecutor executor{cache, mToolchain, mThreads};
+        }
+
+        for (const BuildTask *task : cache.buildTasks())
+        {
+            if (const TaskState *state = cache.taskState(*task))
+            {
+                mStates.insert_or_assign(cache.taskName(*task), *state);
+            }
+
+            if (const std::optional<std::chrono::milliseconds> duration = cache.taskDuration(*task))
+            {
+                mDurations.insert_or_assign(cache.taskName(*task), *duration);
+            }
+        }
+
+        mErrors.insert(mErrors.end(), cache.errors().begin(), cache.errors().end());
+    }
+
+    [[nodiscard]] auto closure(File *header, std::vector<std::pair<const File *, const Snapshot *>> *files) -> Closure
+    {
+        std::vector<std::pair<File *, bool>> stack{{header, false}};
+        std::vector<std::pair<File *, bool>> closureFiles;
+        std::unordered_set<const File *> visited{header};
+
+        while (!stack.empty())
+        {
+            const std::pair<File *, bool> file = stack.back();
+            stack.pop_back();
+
+            if (!mScanned.contains(file.first))
+            {
+                return Closure::Incomplete;
+            }
+
+            const std::vector<File *> &dependencies = resolved(file.first);
+
+            for (std::size_t i = 0; i < dependencies.size(); ++i)
+            {
+                const Dependency &dependency = file.first->dependencies()[i];
+
+                if (std::holds_alternative<ImportModuleDependency>(dependency))
+                {
+                    return Closure::Unsupported;
+                }
+
+                if (dependencies[i] && visited.insert(dependencies[i]).second)
+                {
+                    stack.emplace_back(dependencies[i], isSourceInclude(dependency));
+                }
+            }
+
+            closureFiles.push_back(file);
+        }
+
+        for (const std::pair<File *, bool> &file : closureFiles)
+        {
+            files->emplace_back(file.first, &snapshot(file.first, file.second));
+        }
+
+        return Closure::Complete;
+    }
+
+    auto dispatchCandidates() -> void
+    {
+        std::vector<File *> candidates;
+
+        for (File *candidate : mCandidates)
+        {
+            HeaderUnit unit{.header = candidate};
+
+            switch (closure(candidate, &unit.files))
+            {
+            case Closure::Complete:
+                mPendingUnits.push_back(std::move(unit));
+                mDispatchedHeaderUnits++;
+                break;
+            case Closure::Incomplete:
+                candidates.push_back(candidate);
+                break;
+            case Closure::Unsupported:
+                break;
+            }
+        }
+
+        mCandidates = std::move(candidates);
+    }
+
+    [[nodiscard]] static auto isHeaderImport(const Dependency &dependency) -> bool
+    {
+        return std::holds_alternative<ImportExternalHeaderDependency>(dependency) || std::holds_alternative<ImportLocalHeaderDependency>(dependency);
+    }
+
+    [[nodiscard]] static auto isSourceInclude(const Dependency &dependency) -> bool
+    {
+        return std::holds_alternative<IncludeExternalSourceDependency>(dependency) || std::holds_alternative<IncludeLocalSourceDependency>(dependency);
+    }
+
+    static auto link(Dependency *dependency, File *file) -> void
+    {
+        std::visit([file](auto &&value) {
+            if constexpr (requires { value.header; })
+            {
+                value.header = static_cast<Header *>(file);
+            }
+            else if constexpr (requires { value.source; })
+            {
+                value.source = static_cast<Source *>(file);
+            }
+        },
+                   *dependency);
+    }
+
+    [[nodiscard]] auto resolve(const Dependency &dependency, const File *file) const -> File *
+    {
+        if (const auto *dep = std::get_if<IncludeExternalHeaderDependency>(&dependency))
+        {
+            return mBuildCache.header(dep->name);
+        }
+
+        if (const auto *dep = std::get_if<IncludeExternalSourceDependency>(&dependency))
+        {
+            return mBuildCache.source(dep->name);
+        }
+
+        if (const auto *dep = std::get_if<IncludeLocalHeaderDependency>(&dependency))
+        {
+            return mBuildCache.header(dep->name, file);
+        }
+
+        if (const auto *dep = std::get_if<IncludeLocalSourceDependency>(&dependency))
+        {
+            return mBuildCache.source(dep->name, file);
+        }
+
+        if (const auto *dep = std::get_if<ImportExternalHeaderDependency>(&dependency))
+        {
+            return mBuildCache.header(dep->name);
+        }
+
+        if (const auto *dep = std::get_if<ImportLocalHeaderDependency>(&dependency))
+        {
+            return mBuildCache.header(dep->name, file);
+        }
+
+        return nullptr;
+    }
+
+    [[nodiscard]] auto resolved(File *file) -> const std::vector<File *> &
+    {
+        std::unordered_map<const File *, std::vector<File *>>::iterator it = mResolved.find(file);
+
+        if (it == mResolved.end())
+        {
+            std::vector<File *> files;
+
+            for (const Dependency &dependency : file->dependencies())
+            {
+                files.push_back(resolve(dependency, file));
+            }
+
+            it = mResolved.insert({file, std::move(files)}).first;
+        }
+
+        return it->second;
+    }
+
+    [[nodiscard]] auto snapshot(File *file, bool source) -> const Snapshot &
+    {
+        std::unordered_map<const File *, Snapshot>::iterator it = mSnapshots.find(file);
+
+        if (it == mSnapshots.end())
+        {
+            it = mSnapshots.insert({file, Snapshot{.path = file->path(), .project = file->project()->name(), .contentHash = file->contentHash(), .dependencies = {file->dependencies().begin(), file->dependencies().end()}, .files = resolved(file), .source = source}}).first;
+        }
+
+        return it->second;
+    }
+
+    auto work() -> void
+    {
+        std::unique_lock lock{mMutex};
+
+        while (true)
+        {
+            mWorkAvailable.wait(lock, [this] { return mStopping || !mPendingNames.empty() || !mPendingUnits.empty(); });
+
+            if (mPendingNames.empty() && mPendingUnits.empty())
+            {
+                return;
+            }
+
+            const std::vector<std::string> names = std::move(mPendingNames);
+            const std::vector<HeaderUnit> units = std::move(mPendingUnits);
+            mPendingNames.clear();
+            mPendingUnits.clear();
+            lock.unlock();
+
+            try
+            {
+                build(names, units);
+            }
+            catch (std::exception &e)
+            {
+                mErrors.push_back(Error{.component = COMPONENT, .what = e.what()});
+            }
+
+            lock.lock();
+        }
+    }
+
+    BuildCache &mBuildCache;
+    Toolchain mToolchain;
+    std::size_t mThreads = 0;
+    std::unordered_map<std::string, TaskState> mStates;
+    std::unordered_map<std::string, std::chrono::milliseconds> mDurations;
+    std::vector<Error> mErrors;
+    std::unordered_set<std::string> mNames;
+    std::vector<std::string> mPendingNames;
+    std::unordered_set<const File *> mScanned;
+    std::unordered_set<const File *> mImported;
+    std::vector<File *> mCandidates;
+    std::unordered_map<const File *, std::vector<File *>> mResolved;
+    std::unordered_map<const File *, Snapshot> mSnapshots;
+    std::vector<HeaderUnit> mPendingUnits;
+    std::size_t mDispatchedHeaderUnits = 0;
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailable;
+    bool mStopping = false;
+    std::thread mThread;
+    static constexpr char COMPONENT[] = "HeaderUnitPrebuilder";
+};
+}
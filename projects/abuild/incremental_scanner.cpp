@@ -0,0 +1,119 @@
+#ifdef _MSC_VER
+export module abuild : incremental_scanner;
+import : build_cache;
+import : code_scanner;
+import : dependency_scanner;
+#endif
+
+namespace abuild
+{
+export class IncrementalScanner
+{
+public:
+    explicit IncrementalScanner(BuildCache &cache) :
+        IncrementalScanner{cache, std::thread::hardware_concurrency()}
+    {
+    }
+
+    IncrementalScanner(BuildCache &cache, std::size_t threads) :
+        IncrementalScanner{cache, cache.changedFiles(threads), threads}
+    {
+    }
+
+    IncrementalScanner(BuildCache &cache, const ChangedFiles &changes, std::size_t threads) :
+        mBuildCache{cache}
+    {
+        mModifiedFiles = changes.sources.size() + changes.headers.size();
+        mFullScanRequired = !changes.removed.empty();
+        collectChanges(changes.sources, &mSources);
+        collectChanges(changes.headers, &mHeaders);
+
+        if (!mFullScanRequired && (!mSources.empty() || !mHeaders.empty()))
+        {
+            rescan(threads);
+        }
+    }
+
+    [[nodiscard]] auto fullScanRequired() const noexcept -> bool
+    {
+        return mFullScanRequired;
+    }
+
+    [[nodiscard]] auto modifiedFiles() const noexcept -> std::size_t
+    {
+        return mModifiedFiles;
+    }
+
+    [[nodiscard]] auto rescannedHeaders() const noexcept -> const std::vector<Header *> &
+    {
+        return mHeaders;
+    }
+
+    [[nodiscard]] auto rescannedSources() const noexcept -> const std::vector<Source *> &
+    {
+        return mSources;
+    }
+
+private:
+    template<typename T>
+    auto collectChanges(const std::vector<T *> &files, std::vector<T *> *changed) -> void
+    {
+        for (T *file : files)
+        {
+            if (mFullScanRequired)
+            {
+                return;
+            }
+
+            if (file->contentHash() != Digest{} && file->view().hash() == file->contentHash())
+            {
+                file->update();
+            }
+            else
+            {
+                mFullScanRequired = isModuleFile(file);
+                changed->push_back(file);
+            }
+        }
+    }
+
+    [[nodiscard]] auto isModuleFile(const File *file) const -> bool
+    {
+        return mBuildCache.cppModule(file) != nullptr || mBuildCache.cppModulePartition(file) != nullptr;
+    }
+
+    auto rescan(std::size_t threads) -> void
+    {
+        const TraceSpan span{mBuildCache.trace(), "IncrementalScanner", "IncrementalScanner"};
+        std::vector<File *> files;
+        files.insert(files.end(), mSources.begin(), mSources.end());
+        files.insert(files.end(), mHeaders.begin(), mHeaders.end());
+
+        for (File *file : files)
+        {
+            file->dependencies().clear();
+            file->update();
+            mBuildCache.removeWarnings(file);
+        }
+
+        CodeScanner{mBuildCache, mSources, mHeaders, threads};
+
+        for (const Source *source : mSources)
+        {
+            if (isModuleFile(source))
+            {
+                mFullScanRequired = true;
+                return;
+            }
+        }
+
+        DependencyScanner{mBuildCache, files};
+    }
+
+    BuildCache &mBuildCache;
+    std::vector<Source *> mSources;
+    std::vector<Header *> mHeaders;
+    std::size_t mModifiedFiles = 0;
+    bool mFullScanRequired = false;
+};
+}
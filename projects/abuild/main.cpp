@@ -1,33 +1,165 @@
 import abuild;
 
-auto main([[maybe_unused]] int argc, [[maybe_unused]] char *argv[]) -> int
+auto watch() -> void
+{
+    abuild::BuildCache cache;
+    const std::filesystem::path snapshot = cache.projectRoot() / cache.settings().buildDirectory() / "abuild.cache";
+    const std::filesystem::path trace = cache.projectRoot() / cache.settings().buildDirectory() / "abuild.trace.json";
+
+    std::cout << "Watching " << cache.projectRoot().string() << "... ";
+    auto start = std::chrono::steady_clock::now();
+    abuild::CacheWatcher watcher{cache};
+    abuild::ToolchainScanner{cache};
+    abuild::BuildGraph{cache};
+    cache.save(snapshot);
+    cache.trace().save(trace);
+    cache.trace().clear();
+    auto end = std::chrono::steady_clock::now();
+    std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms\n";
+
+    while (true)
+    {
+        if (watcher.update(std::chrono::seconds{1}))
+        {
+            start = std::chrono::steady_clock::now();
+            cache.clearBuildTasks();
+            abuild::BuildGraph{cache};
+            cache.save(snapshot);
+            cache.trace().save(trace);
+            cache.trace().clear();
+            end = std::chrono::steady_clock::now();
+            std::cout << "Build graph updated (" << watcher.modifiedFiles() << " modified files, " << watcher.fullScans() << " full scans) " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms\n";
+        }
+    }
+}
+
+auto simulate() -> void
+{
+    abuild::BuildCache cache;
+
+    if (!cache.load(cache.projectRoot() / cache.settings().buildDirectory() / "abuild.cache"))
+    {
+        std::cout << "Build cache is out of date. Run a build first.\n";
+        return;
+    }
+
+    abuild::BuildGraph{cache};
+    const abuild::CompactBuildGraph graph{cache};
+    const abuild::BuildReport report{cache, graph};
+    const std::size_t threads = std::thread::hardware_concurrency();
+    std::cout << report.text() << "Simulation (" << threads << " threads):\n";
+
+    for (const std::pair<const char *, abuild::SchedulingPolicy> &policy : {std::pair{"critical path", abuild::SchedulingPolicy::CriticalPath}, std::pair{"modules first", abuild::SchedulingPolicy::ModulesFirst}})
+    {
+        const abuild::BuildSimulation simulation{graph, report, abuild::BuildSchedule{graph, report, policy.second}, threads};
+        std::cout << "    " << policy.first << ": " << simulation.duration().count() << " ms, mean TU release " << simulation.meanReadyTime<abuild::CompileSourceTask>().count() << " ms, utilization " << static_cast<int>(simulation.utilization() * 100) << "%\n";
+    }
+}
+
+auto main(int argc, char *argv[]) -> int
 {
     try
     {
+        if (argc > 1 && std::string_view{argv[1]} == "--watch")
+        {
+            watch();
+            return 0;
+        }
+
+        if (argc > 1 && std::string_view{argv[1]} == "--simulate")
+        {
+            simulate();
+            return 0;
+        }
+
         abuild::BuildCache cache;
 
+        const std::filesystem::path snapshot = cache.projectRoot() / cache.settings().buildDirectory() / "abuild.cache";
+        bool loaded = false;
+        std::optional<abuild::HeaderUnitPrebuilder> prebuilder;
+
         {
-            std::cout << "ProjectScanner... ";
+            std::cout << "Build cache... ";
             auto start = std::chrono::steady_clock::now();
-            abuild::ProjectScanner scanner{cache};
+            loaded = cache.load(snapshot);
             auto end = std::chrono::steady_clock::now();
-            std::cout << std::chrono::duration_cast<std::chrono::seconds>(end - start).count() << "s\n";
+            std::cout << (loaded ? "loaded " : "out of date ") << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms\n";
         }
 
+        if (loaded)
         {
-            std::cout << "CodeScanner... ";
+            std::cout << "IncrementalScanner... ";
             auto start = std::chrono::steady_clock::now();
-            abuild::CodeScanner scanner{cache};
+            abuild::IncrementalScanner scanner{cache};
             auto end = std::chrono::steady_clock::now();
-            std::cout << std::chrono::duration_cast<std::chrono::seconds>(end - start).count() << "s\n";
+            std::cout << scanner.rescannedSources().size() + scanner.rescannedHeaders().size() << " rescanned " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms\n";
+
+            if (scanner.fullScanRequired())
+            {
+                abuild::BuildCache fresh;
+                fresh.setTaskDurations(cache.taskDurations());
+                fresh.setTaskStates(cache.taskStates());
+                fresh.trace() = std::move(cache.trace());
+                cache = std::move(fresh);
+                loaded = false;
+            }
+            else if (scanner.modifiedFiles() != 0)
+            {
+                cache.save(snapshot);
+            }
         }
 
+        if (!loaded)
         {
-            std::cout << "DependencyScanner... ";
-            auto start = std::chrono::steady_clock::now();
-            abuild::DependencyScanner scanner{cache};
-            auto end = std::chrono::steady_clock::now();
-            std::cout << std::chrono::duration_cast<std::chrono::seconds>(end - start).count() << "s\n";
+            {
+                std::cout << "ProjectScanner... ";
+                auto start = std::chrono::steady_clock::now();
+                abuild::ProjectScanner scanner{cache};
+                auto end = std::chrono::steady_clock::now();
+                std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms\n";
+            }
+
+            {
+                std::cout << "ToolchainScanner... ";
+                auto start = std::chrono::steady_clock::now();
+                abuild::ToolchainScanner scanner{cache};
+                auto end = std::chrono::steady_clock::now();
+                std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms\n";
+            }
+
+            const std::size_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+            std::size_t scanThreads = threads;
+
+            if (!cache.toolchains().empty())
+            {
+                const std::size_t prebuildThreads = std::max(threads / 4, std::size_t{1});
+                scanThreads = std::max(threads - prebuildThreads, std::size_t{1});
+                prebuilder.emplace(cache, *cache.toolchains().front(), prebuildThreads);
+            }
+
+            {
+                std::cout << "CodeScanner... ";
+                auto start = std::chrono::steady_clock::now();
+
+                abuild::CodeScanner scanner{cache, scanThreads, [&](abuild::File *file) {
+                                                if (prebuilder)
+                                                {
+                                                    prebuilder->add(file);
+                                                }
+                                            }};
+                auto end = std::chrono::steady_clock::now();
+                std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms\n";
+            }
+
+            {
+                std::cout << "DependencyScanner... ";
+                auto start = std::chrono::steady_clock::now();
+                abuild::DependencyScanner scanner{cache};
+                auto end = std::chrono::steady_clock::now();
+                std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms\n";
+            }
+
+            cache.save(snapshot);
         }
 
         {
@@ -35,19 +167,49 @@ auto main([[maybe_unused]] int argc, [[maybe_unused]] char *argv[]) -> int
             auto start = std::chrono::steady_clock::now();
             abuild::BuildGraph graph{cache};
             auto end = std::chrono::steady_clock::now();
-            std::cout << std::chrono::duration_cast<std::chrono::seconds>(end - start).count() << "s\n";
+            std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms\n";
         }
 
+        if (!cache.toolchains().empty())
+        {
+            std::cout << "Build (" << cache.toolchains().front()->name << ")... ";
+            auto start = std::chrono::steady_clock::now();
+            const std::size_t prebuilt = prebuilder ? prebuilder->dispatchedTasks() : 0;
+            prebuilder.reset();
+            abuild::BuildExecutor executor{cache, *cache.toolchains().front()};
+            auto end = std::chrono::steady_clock::now();
+            std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms\n";
+            std::cout << "Executed tasks: " << executor.executedTasks() << "/" << cache.buildTasks().size() << " (up to date: " << executor.upToDateTasks() << ", cut off: " << executor.cutOffTasks() << ", fetched from store: " << executor.fetchedTasks() << ", prebuilt during scan: " << prebuilt << ")\n";
+            cache.save(snapshot);
+
+            const abuild::CompactBuildGraph graph{cache};
+            const abuild::BuildReport report{cache, graph};
+            std::ofstream{cache.projectRoot() / cache.settings().buildDirectory() / "abuild.report.json"} << report.json();
+            std::cout << '\n'
+                      << report.text();
+        }
+
+        cache.trace().save(cache.projectRoot() / cache.settings().buildDirectory() / "abuild.trace.json");
+
         std::cout << "\nWarnings: " << cache.warnings().size();
         std::cout << "\nSources: " << cache.sources().size();
         std::cout << "\nHeaders: " << cache.headers().size();
         std::cout << "\nProjects: " << cache.projects().size();
-        std::cout << "\nModules: " << cache.modules().size() << "\n\n";
+        std::cout << "\nModules: " << cache.modules().size();
+        std::cout << "\nAllocations: " << cache.allocationStatistics().allocations << " (" << cache.allocationStatistics().bytes / 1024 << " KB) in "
+                  << cache.allocationStatistics().blockAllocations << " blocks (" << cache.allocationStatistics().blockBytes / 1024 << " KB), "
+                  << cache.allocationStatistics().heapAllocations << " names on the heap (" << cache.allocationStatistics().heapBytes / 1024 << " KB)";
+        std::cout << "\nErrors: " << cache.errors().size() << "\n\n";
 
         for (const abuild::Warning &warning : cache.warnings())
         {
             std::cout << warning.component << ": " << warning.what << '\n';
         }
+
+        for (const abuild::Error &error : cache.errors())
+        {
+            std::cout << error.component << ": " << error.what << '\n';
+        }
     }
     catch (std::exception &e)
     {
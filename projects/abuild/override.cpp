@@ -27,13 +27,17 @@ public:
     {
         if (mData.IsObject() && mData.HasMember("settings"))
         {
+            applyBuildDirectory(settings);
             applyCppHeaderExtensions(settings);
             applyCppSourceExtensions(settings);
             applyExecutableFilenames(settings);
             applyIgnoreDirectories(settings);
+            applyPreambleThreshold(settings);
             applyProjectNameSeparator(settings);
             applySkipDirectories(settings);
             applySquashDirectories(settings);
+            applyStoreDirectory(settings);
+            applyStoreSizeLimit(settings);
             applyTestDirectories(settings);
             applyGCCInstallDirectory(settings);
             applyClangInstallDirectory(settings);
@@ -42,6 +46,14 @@ public:
     }
 
 private:
+    auto applyBuildDirectory(Settings *settings) -> void
+    {
+        if (hasValidString("settings", "buildDirectory"))
+        {
+            settings->setBuildDirectory(value("settings", "buildDirectory"));
+        }
+    }
+
     auto applyClangInstallDirectory(Settings *settings) -> void
     {
         if (hasValidString("settings", "clangInstallDirectory"))
@@ -98,6 +110,14 @@ private:
         }
     }
 
+    auto applyPreambleThreshold(Settings *settings) -> void
+    {
+        if (hasValidNumber("settings", "preambleThreshold"))
+        {
+            settings->setPreambleThreshold(mData["settings"]["preambleThreshold"].GetUint64());
+        }
+    }
+
     auto applyProjectNameSeparator(Settings *settings) -> void
     {
         if (hasValidString("settings", "projectNameSeparator"))
@@ -122,6 +142,22 @@ private:
         }
     }
 
+    auto applyStoreDirectory(Settings *settings) -> void
+    {
+        if (hasValidString("settings", "storeDirectory"))
+        {
+            settings->setStoreDirectory(value("settings", "storeDirectory"));
+        }
+    }
+
+    auto applyStoreSizeLimit(Settings *settings) -> void
+    {
+        if (hasValidNumber("settings", "storeSizeLimit"))
+        {
+            settings->setStoreSizeLimit(mData["settings"]["storeSizeLimit"].GetUint64());
+        }
+    }
+
     auto applyTestDirectories(Settings *settings) -> void
     {
         if (hasValidArray("settings", "testDirectories"))
@@ -135,6 +171,11 @@ private:
         return mData[parent].HasMember(name) && validateArray(parent, name);
     }
 
+    [[nodiscard]] auto hasValidNumber(const char *parent, const char *name) const -> bool
+    {
+        return mData[parent].HasMember(name) && validateNumber(parent, name);
+    }
+
     [[nodiscard]] auto hasValidString(const char *parent, const char *name) const -> bool
     {
         return mData[parent].HasMember(name) && validateString(parent, name);
@@ -173,6 +214,18 @@ private:
         }
     }
 
+    auto validateNumber(const char *parent, const char *name) const -> bool
+    {
+        if (!mData[parent][name].IsUint64())
+        {
+            throw std::runtime_error{"Override error. Value of [\"" + std::string{parent} + "\"][\"" + std::string{name} + "\"] must be a non-negative integer."};
+        }
+        else
+        {
+            return true;
+        }
+    }
+
     auto validateString(const char *parent, const char *name) const -> bool
     {
         if (!mData[parent][name].IsString())
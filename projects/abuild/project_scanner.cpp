@@ -2,6 +2,7 @@
 export module abuild : project_scanner;
 export import : build_cache;
 import : settings;
+import : thread_pool;
 #endif
 
 namespace abuild
@@ -10,12 +11,34 @@ export class ProjectScanner
 {
 public:
     explicit ProjectScanner(BuildCache &cache) :
+        ProjectScanner{cache, std::thread::hardware_concurrency()}
+    {
+    }
+
+    ProjectScanner(BuildCache &cache, std::size_t threads) :
         mBuildCache{cache}
     {
-        scanDirectory(mBuildCache.projectRoot());
+        const TraceSpan span{mBuildCache.trace(), "ProjectScanner", "ProjectScanner"};
+        Directory root{.path = mBuildCache.projectRoot()};
+        walk(&root, threads);
+        processDirectory(root);
+        mBuildCache.setDirectories(mDirectories);
+    }
+
+    [[nodiscard]] auto directories() const noexcept -> const std::vector<std::filesystem::path> &
+    {
+        return mDirectories;
     }
 
 private:
+    struct Directory
+    {
+        std::filesystem::path path;
+        std::string projectName;
+        bool projectNameFinal = false;
+        std::vector<std::variant<std::filesystem::path, std::unique_ptr<Directory>>> entries;
+    };
+
     auto appendProjectName(std::string *projectName, const std::string &directoryName) const -> void
     {
         if (projectName->empty())
@@ -40,37 +63,55 @@ private:
         }
     }
 
-    [[nodiscard]] auto isIgnoreDirectory(const std::filesystem::path &path) -> bool
+    [[nodiscard]] auto isCppFile(const std::filesystem::path &path) const -> bool
+    {
+        const std::string extension = path.extension().string();
+        return mBuildCache.settings().cppSourceExtensions().contains(extension) || mBuildCache.settings().cppHeaderExtensions().contains(extension);
+    }
+
+    [[nodiscard]] auto isIgnoreDirectory(const std::filesystem::path &path) const -> bool
     {
         return path.filename().string().front() == '.' || mBuildCache.settings().ignoreDirectories().contains(path.filename().string());
     }
 
-    [[nodiscard]] auto isSkipDirectory(const std::filesystem::path &path) -> bool
+    [[nodiscard]] auto isSkipDirectory(const std::filesystem::path &path) const -> bool
     {
         return mBuildCache.settings().skipDirectories().contains(path.filename().string());
     }
 
-    [[nodiscard]] auto isSquashDirectory(const std::filesystem::path &path) -> bool
+    [[nodiscard]] auto isSquashDirectory(const std::filesystem::path &path) const -> bool
     {
         return mBuildCache.settings().squashDirectories().contains(path.filename().string());
     }
 
-    [[nodiscard]] auto isTestDirectory(const std::filesystem::path &path) -> bool
+    [[nodiscard]] auto isTestDirectory(const std::filesystem::path &path) const -> bool
     {
         return mBuildCache.settings().testDirectories().contains(path.filename().string());
     }
 
-    [[nodiscard]] auto pathDirectories(std::filesystem::path path) -> std::vector<std::filesystem::path>
+    auto processDirectory(const Directory &directory) -> void
     {
-        std::vector<std::filesystem::path> directories;
+        const std::string projectName = ensureProjectName(directory.projectName);
+        mDirectories.push_back(directory.path);
 
-        while (path != mBuildCache.projectRoot())
+        for (const std::variant<std::filesystem::path, std::unique_ptr<Directory>> &entry : directory.entries)
         {
-            directories.push_back(path);
-            path = path.parent_path();
+            if (const auto *path = std::get_if<std::filesystem::path>(&entry))
+            {
+                processFile(*path, projectName);
+            }
+            else
+            {
+                processDirectory(*std::get<std::unique_ptr<Directory>>(entry));
+            }
         }
 
-        return directories;
+        Project *project = mBuildCache.project(projectName);
+
+        if (isTestDirectory(directory.path) && project)
+        {
+            project->setType(Project::Type::Executable);
+        }
     }
 
     auto processFile(const std::filesystem::path &path, const std::string &projectName) -> void
@@ -90,61 +131,76 @@ private:
         }
     }
 
-    [[nodiscard]] auto projectNameFromDirectories(const std::vector<std::filesystem::path> &directories) -> std::string
+    auto scanDirectory(Directory *directory, ThreadPool *pool) const -> void
     {
-        std::string projectName;
+        const TraceSpan span{mBuildCache.trace(), "ProjectScanner", [directory] { return directory->path.string(); }};
 
-        for (auto it = directories.crbegin(); it != directories.crend() && !isSquashDirectory(*it); ++it)
+        for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(directory->path))
         {
-            if (isTestDirectory(*it))
+            if (entry.is_regular_file())
             {
-                return ensureProjectName(projectName) + mBuildCache.settings().projectNameSeparator() + it->filename().string();
+                if (isCppFile(entry.path()))
+                {
+                    directory->entries.emplace_back(entry.path());
+                }
             }
-            else if (!isSkipDirectory(*it))
+            else if (entry.is_directory() && !isIgnoreDirectory(entry.path()))
             {
-                appendProjectName(&projectName, it->filename().string());
+                Directory *subdirectory = std::get<std::unique_ptr<Directory>>(directory->entries.emplace_back(subdirectoryOf(*directory, entry.path()))).get();
+
+                if (pool)
+                {
+                    pool->run([this, subdirectory, pool] { scanDirectory(subdirectory, pool); });
+                }
+                else
+                {
+                    scanDirectory(subdirectory, nullptr);
+                }
             }
         }
-
-        return ensureProjectName(projectName);
     }
 
-    [[nodiscard]] auto projectNameFromPath(const std::filesystem::path &path) -> std::string
+    [[nodiscard]] auto subdirectoryOf(const Directory &parent, const std::filesystem::path &path) const -> std::unique_ptr<Directory>
     {
-        return projectNameFromDirectories(pathDirectories(path));
-    }
+        auto directory = std::make_unique<Directory>(Directory{.path = path, .projectName = parent.projectName, .projectNameFinal = parent.projectNameFinal});
 
-    auto scanDirectoryEntry(const std::filesystem::directory_entry &entry, const std::string &projectName) -> void
-    {
-        const std::filesystem::path entryPath = entry.path();
+        if (directory->projectNameFinal)
+        {
+            return directory;
+        }
 
-        if (std::filesystem::is_regular_file(entryPath))
+        if (isSquashDirectory(path))
         {
-            processFile(entryPath, projectName);
+            directory->projectNameFinal = true;
         }
-        else if (std::filesystem::is_directory(entryPath) && !isIgnoreDirectory(entryPath))
+        else if (isTestDirectory(path))
         {
-            scanDirectory(entryPath);
+            directory->projectName = ensureProjectName(directory->projectName) + mBuildCache.settings().projectNameSeparator() + path.filename().string();
+            directory->projectNameFinal = true;
         }
+        else if (!isSkipDirectory(path))
+        {
+            appendProjectName(&directory->projectName, path.filename().string());
+        }
+
+        return directory;
     }
 
-    auto scanDirectory(const std::filesystem::path &path) -> void
+    auto walk(Directory *root, std::size_t threads) const -> void
     {
-        const std::string projectName = projectNameFromPath(path);
-
-        for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(path))
+        if (threads <= 1)
         {
-            scanDirectoryEntry(entry, projectName);
+            scanDirectory(root, nullptr);
         }
-
-        Project *project = mBuildCache.project(projectName);
-
-        if (isTestDirectory(path) && project)
+        else
         {
-            project->setType(Project::Type::Executable);
+            ThreadPool pool{threads};
+            pool.run([&] { scanDirectory(root, &pool); });
+            pool.wait();
         }
     }
 
     BuildCache &mBuildCache;
+    std::vector<std::filesystem::path> mDirectories;
 };
 }
@@ -8,6 +8,11 @@ namespace abuild
 export class Settings
 {
 public:
+    [[nodiscard]] auto buildDirectory() const noexcept -> const std::string &
+    {
+        return mBuildDirectory;
+    }
+
     [[nodiscard]] auto clangInstallDirectory() const noexcept -> const std::string &
     {
         return mClangInstallDirectory;
@@ -43,11 +48,21 @@ public:
         return mMSVCInstallDirectory;
     }
 
+    [[nodiscard]] auto preambleThreshold() const noexcept -> std::size_t
+    {
+        return mPreambleThreshold;
+    }
+
     [[nodiscard]] auto projectNameSeparator() const noexcept -> const std::string &
     {
         return mProjectNameSeparator;
     }
 
+    auto setBuildDirectory(std::string directory) noexcept -> void
+    {
+        mBuildDirectory = std::move(directory);
+    }
+
     auto setClangInstallDirectory(std::string directory) noexcept -> void
     {
         mClangInstallDirectory = std::move(directory);
@@ -83,6 +98,11 @@ public:
         mMSVCInstallDirectory = std::move(directory);
     }
 
+    auto setPreambleThreshold(std::size_t threshold) noexcept -> void
+    {
+        mPreambleThreshold = threshold;
+    }
+
     auto setProjectNameSeparator(std::string separator) noexcept -> void
     {
         mProjectNameSeparator = std::move(separator);
@@ -98,6 +118,16 @@ public:
         mSquashDirectories = std::move(directories);
     }
 
+    auto setStoreDirectory(std::string directory) noexcept -> void
+    {
+        mStoreDirectory = std::move(directory);
+    }
+
+    auto setStoreSizeLimit(std::uint64_t limit) noexcept -> void
+    {
+        mStoreSizeLimit = limit;
+    }
+
     auto setTestDirectories(std::unordered_set<std::string> directories) noexcept -> void
     {
         mTestDirectories = std::move(directories);
@@ -113,13 +143,45 @@ public:
         return mSquashDirectories;
     }
 
+    [[nodiscard]] auto storeDirectory() const noexcept -> const std::string &
+    {
+        return mStoreDirectory;
+    }
+
+    [[nodiscard]] auto storeSizeLimit() const noexcept -> std::uint64_t
+    {
+        return mStoreSizeLimit;
+    }
+
     [[nodiscard]] auto testDirectories() const noexcept -> const std::unordered_set<std::string> &
     {
         return mTestDirectories;
     }
 
 private:
+    [[nodiscard]] static auto defaultStoreDirectory() -> std::string
+    {
+#ifdef _MSC_VER
+        char *value = nullptr;
+        std::size_t size = 0;
+
+        if (_dupenv_s(&value, &size, "LOCALAPPDATA") != 0 || value == nullptr)
+        {
+            return {};
+        }
+
+        const std::string home = value;
+        std::free(value);
+        return (std::filesystem::path{home} / "abuild" / "store").generic_string();
+#else
+        const char *home = std::getenv("HOME");
+        return home == nullptr ? std::string{} : (std::filesystem::path{home} / ".abuild" / "store").generic_string();
+#endif
+    }
+
+    std::string mBuildDirectory = "build";
     std::string mProjectNameSeparator = ".";
+    std::size_t mPreambleThreshold = 0;
     std::string mGCCInstallDirectory = "/usr";
 #ifdef _WIN32
     std::string mClangInstallDirectory = "C:/Program Files/LLVM";
@@ -127,6 +189,8 @@ private:
     std::string mClangInstallDirectory = "/usr";
 #endif
     std::string mMSVCInstallDirectory = "C:/Program Files (x86)/Microsoft Visual Studio/";
+    std::string mStoreDirectory = defaultStoreDirectory();
+    std::uint64_t mStoreSizeLimit = std::uint64_t{5} * 1024 * 1024 * 1024;
     std::unordered_set<std::string> mCppHeaderExtensions{".hpp", ".hxx", ".h"};
     std::unordered_set<std::string> mCppSourceExtensions{".cpp", ".cxx", ".cc", ".ixx"};
     std::unordered_set<std::string> mExecutableFilenames{"main", "Main", "WinMain"};
@@ -0,0 +1,69 @@
+#ifdef _MSC_VER
+export module abuild : string_interner;
+export import<astl.hpp>;
+#endif
+
+namespace abuild
+{
+class StringInterner
+{
+public:
+    [[nodiscard]] auto find(std::string_view value) const -> std::uint32_t
+    {
+        std::unordered_map<std::string_view, std::uint32_t>::const_iterator it = mIds.find(value);
+
+        if (it != mIds.end())
+        {
+            return it->second;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    auto intern(std::string_view value) -> std::uint32_t
+    {
+        std::uint32_t id = find(value);
+
+        if (id == 0)
+        {
+            const std::string_view stored = store(value);
+            mValues.push_back(stored);
+            id = static_cast<std::uint32_t>(mValues.size());
+            mIds.insert({stored, id});
+        }
+
+        return id;
+    }
+
+    [[nodiscard]] auto value(std::uint32_t id) const noexcept -> std::string_view
+    {
+        return mValues[id - 1];
+    }
+
+private:
+    [[nodiscard]] auto store(std::string_view value) -> std::string_view
+    {
+        if (mBlocks.empty() || mCapacity - mUsed < value.size())
+        {
+            mCapacity = std::max(BLOCK_SIZE, value.size());
+            mBlocks.push_back(std::make_unique<char[]>(mCapacity));
+            mUsed = 0;
+        }
+
+        char *data = mBlocks.back().get() + mUsed;
+        std::memcpy(data, value.data(), value.size());
+        mUsed += value.size();
+        return std::string_view{data, value.size()};
+    }
+
+    static constexpr std::size_t BLOCK_SIZE = 65536;
+
+    std::vector<std::unique_ptr<char[]>> mBlocks;
+    std::size_t mCapacity = 0;
+    std::size_t mUsed = 0;
+    std::vector<std::string_view> mValues;
+    std::unordered_map<std::string_view, std::uint32_t> mIds;
+};
+}
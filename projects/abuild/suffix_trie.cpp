@@ -0,0 +1,125 @@
+#ifdef _MSC_VER
+export module abuild : suffix_trie;
+export import<astl.hpp>;
+#endif
+
+namespace abuild
+{
+template<typename T, typename Key>
+class SuffixTrie
+{
+public:
+    template<typename Component>
+    auto insert(T *value, const Key &key, const Component &component) -> void
+    {
+        std::uint32_t node = 0;
+
+        for (std::size_t depth = 0;; ++depth)
+        {
+            if (mNodes[node].first == nullptr)
+            {
+                mNodes[node] = Node{.first = value, .leaf = value, .key = key};
+                return;
+            }
+
+            if (mNodes[node].leaf != nullptr)
+            {
+                split(node, depth, component);
+            }
+
+            const std::optional<std::uint32_t> part = component(key, depth);
+
+            if (!part)
+            {
+                return;
+            }
+
+            node = child(node, *part);
+        }
+    }
+
+    template<typename Query, typename Component>
+    [[nodiscard]] auto find(Query &&query, const Component &component) const -> T *
+    {
+        std::uint32_t node = 0;
+        std::size_t depth = 0;
+
+        for (std::optional<std::uint32_t> part = query(); part; part = query(), ++depth)
+        {
+            const Node &current = mNodes[node];
+
+            if (current.leaf != nullptr)
+            {
+                return matches(current, depth, *part, query, component) ? current.leaf : nullptr;
+            }
+
+            typename std::unordered_map<std::uint64_t, std::uint32_t>::const_iterator it = mChildren.find(childKey(node, *part));
+
+            if (it == mChildren.end())
+            {
+                return nullptr;
+            }
+
+            node = it->second;
+        }
+
+        return mNodes[node].first;
+    }
+
+private:
+    struct Node
+    {
+        T *first = nullptr;
+        T *leaf = nullptr;
+        Key key = {};
+    };
+
+    [[nodiscard]] auto child(std::uint32_t node, std::uint32_t part) -> std::uint32_t
+    {
+        const std::pair<typename std::unordered_map<std::uint64_t, std::uint32_t>::iterator, bool> result = mChildren.insert({childKey(node, part), static_cast<std::uint32_t>(mNodes.size())});
+
+        if (result.second)
+        {
+            mNodes.emplace_back();
+        }
+
+        return result.first->second;
+    }
+
+    [[nodiscard]] static auto childKey(std::uint32_t node, std::uint32_t part) noexcept -> std::uint64_t
+    {
+        return (static_cast<std::uint64_t>(node) << 32) | part;
+    }
+
+    template<typename Query, typename Component>
+    [[nodiscard]] static auto matches(const Node &leaf, std::size_t depth, std::uint32_t part, Query &query, const Component &component) -> bool
+    {
+        for (std::optional<std::uint32_t> next = part; next; next = query(), ++depth)
+        {
+            if (component(leaf.key, depth) != next)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<typename Component>
+    auto split(std::uint32_t node, std::size_t depth, const Component &component) -> void
+    {
+        const Node leaf = mNodes[node];
+        mNodes[node].leaf = nullptr;
+        const std::optional<std::uint32_t> part = component(leaf.key, depth);
+
+        if (part)
+        {
+            const std::uint32_t next = child(node, *part);
+            mNodes[next] = Node{.first = leaf.first, .leaf = leaf.leaf, .key = leaf.key};
+        }
+    }
+
+    std::vector<Node> mNodes{Node{}};
+    std::unordered_map<std::uint64_t, std::uint32_t> mChildren;
+};
+}
@@ -0,0 +1,144 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+struct Counted
+{
+    explicit Counted(std::size_t *destroyed) :
+        destroyed{destroyed}
+    {
+    }
+
+    Counted(const Counted &other) = delete;
+    Counted(Counted &&other) noexcept = delete;
+
+    ~Counted()
+    {
+        ++*destroyed;
+    }
+
+    auto operator=(const Counted &other) -> Counted & = delete;
+    auto operator=(Counted &&other) noexcept -> Counted & = delete;
+
+    std::size_t *destroyed = nullptr;
+};
+
+static const auto testSuite = suite("abuild::Arena", [] {
+    test("type traits", [] {
+        expect(std::is_default_constructible_v<abuild::Arena>).toBe(true);
+        expect(std::is_copy_constructible_v<abuild::Arena>).toBe(false);
+        expect(std::is_nothrow_move_constructible_v<abuild::Arena>).toBe(true);
+        expect(std::is_copy_assignable_v<abuild::Arena>).toBe(false);
+        expect(std::is_nothrow_move_assignable_v<abuild::Arena>).toBe(true);
+        expect(std::is_nothrow_destructible_v<abuild::Arena>).toBe(true);
+    });
+
+    test("create", [] {
+        abuild::Arena arena;
+        std::string *value = arena.create<std::string>("some fairly long string that does not fit the small buffer");
+
+        expect(*value).toBe(std::string{"some fairly long string that does not fit the small buffer"});
+        expect(arena.statistics().allocations).toBe(1u);
+        expect(arena.statistics().bytes).toBe(sizeof(std::string));
+        expect(arena.statistics().blockAllocations).toBe(1u);
+    });
+
+    test("destroy", [] {
+        std::size_t destroyed = 0;
+
+        {
+            abuild::Arena arena;
+            expect(arena.create<Counted>(&destroyed) != nullptr).toBe(true);
+            expect(arena.create<Counted>(&destroyed) != nullptr).toBe(true);
+        }
+
+        expect(destroyed).toBe(2u);
+    });
+
+    test("clear", [] {
+        std::size_t destroyed = 0;
+        abuild::Arena arena;
+        expect(arena.create<Counted>(&destroyed) != nullptr).toBe(true);
+        arena.clear();
+
+        expect(destroyed).toBe(1u);
+        expect(arena.statistics().allocations).toBe(0u);
+        expect(arena.statistics().blockAllocations).toBe(abuild::Arena{}.statistics().blockAllocations);
+    });
+
+    test("move", [] {
+        std::size_t destroyed = 0;
+
+        {
+            abuild::Arena other;
+            {
+                abuild::Arena arena;
+                expect(arena.create<Counted>(&destroyed) != nullptr).toBe(true);
+                other = std::move(arena);
+            }
+
+            expect(destroyed).toBe(0u);
+        }
+
+        expect(destroyed).toBe(1u);
+    });
+
+    test("container allocations", [] {
+        abuild::Arena arena;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            abuild::ArenaVector<int> values{arena.resource()};
+
+            for (int value = 0; value < 10; ++value)
+            {
+                values.push_back(value);
+            }
+        }
+
+        expect(arena.statistics().allocations > 1000u).toBe(true);
+        expect(arena.statistics().blockAllocations < 20u).toBe(true);
+    });
+
+    test("many objects few blocks", [] {
+        abuild::Arena arena;
+        std::uint64_t sum = 0;
+
+        for (std::uint64_t i = 0; i < 10000; ++i)
+        {
+            sum += *arena.create<std::uint64_t>(i);
+        }
+
+        expect(sum).toBe(std::uint64_t{49995000});
+        expect(arena.statistics().allocations).toBe(10000u);
+        expect(arena.statistics().blockAllocations < 20u).toBe(true);
+    });
+
+    test("heap mode", [] {
+        std::size_t destroyed = 0;
+
+        {
+            abuild::Arena arena{abuild::Arena::Mode::Heap};
+
+            for (std::uint64_t i = 0; i < 100; ++i)
+            {
+                expect(arena.create<std::uint64_t>(i) != nullptr).toBe(true);
+            }
+
+            expect(arena.create<Counted>(&destroyed) != nullptr).toBe(true);
+            abuild::ArenaVector<int> values{arena.resource()};
+            values.push_back(1);
+
+            expect(arena.statistics().allocations).toBe(102u);
+            expect(arena.statistics().blockAllocations).toBe(102u);
+            expect(arena.statistics().blockBytes).toBe(100 * sizeof(std::uint64_t) + sizeof(Counted) + sizeof(int));
+        }
+
+        expect(destroyed).toBe(1u);
+    });
+});
@@ -0,0 +1,103 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+[[nodiscard]] auto readArtifact(const std::filesystem::path &path) -> std::string
+{
+    std::ifstream file{path};
+    return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+static const auto testSuite = suite("abuild::ArtifactStore", [] {
+    test("missing entry", [] {
+        TestProject testProject{"abuild_artifact_store_test", {}};
+        abuild::ArtifactStore store{testProject.projectRoot() / "store", 1024};
+
+        expect(store.fetch("0123456789abcdef", {testProject.projectRoot() / "vector.pcm"})).toBe(false);
+        expect(std::filesystem::exists(testProject.projectRoot() / "vector.pcm")).toBe(false);
+    });
+
+    test("store and fetch", [] {
+        TestProjectWithContent testProject{"abuild_artifact_store_test",
+                                           {{"build/vector.pcm", "vector"},
+                                            {"build/string.pcm", "string"}}};
+        abuild::ArtifactStore store{testProject.projectRoot() / "store", 1024};
+        const std::vector<std::filesystem::path> outputs{testProject.projectRoot() / "build" / "vector.pcm", testProject.projectRoot() / "build" / "string.pcm"};
+
+        assert_(store.store("0123456789abcdef", outputs)).toBe(true);
+        std::filesystem::remove_all(testProject.projectRoot() / "build");
+
+        expect(store.fetch("0123456789abcdef", outputs)).toBe(true);
+        expect(readArtifact(outputs[0])).toBe("vector");
+        expect(readArtifact(outputs[1])).toBe("string");
+        expect(std::filesystem::exists(store.root() / "staging")).toBe(true);
+        expect(std::filesystem::is_empty(store.root() / "staging")).toBe(true);
+    });
+
+    test("existing entry is kept", [] {
+        TestProjectWithContent testProject{"abuild_artifact_store_test",
+                                           {{"build/vector.pcm", "vector"}}};
+        abuild::ArtifactStore store{testProject.projectRoot() / "store", 1024};
+        const std::vector<std::filesystem::path> outputs{testProject.projectRoot() / "build" / "vector.pcm"};
+
+        assert_(store.store("0123456789abcdef", outputs)).toBe(true);
+        std::ofstream{outputs[0]} << "changed";
+
+        expect(store.store("0123456789abcdef", outputs)).toBe(true);
+        expect(store.fetch("0123456789abcdef", outputs)).toBe(true);
+        expect(readArtifact(outputs[0])).toBe("vector");
+    });
+
+    test("missing output", [] {
+        TestProject testProject{"abuild_artifact_store_test", {}};
+        abuild::ArtifactStore store{testProject.projectRoot() / "store", 1024};
+
+        expect(store.store("0123456789abcdef", {testProject.projectRoot() / "vector.pcm"})).toBe(false);
+        expect(store.fetch("0123456789abcdef", {testProject.projectRoot() / "vector.pcm"})).toBe(false);
+    });
+
+    test("size", [] {
+        TestProjectWithContent testProject{"abuild_artifact_store_test",
+                                           {{"build/vector.pcm", "vector"},
+                                            {"build/string.pcm", "string"}}};
+        const std::vector<std::filesystem::path> outputs{testProject.projectRoot() / "build" / "vector.pcm", testProject.projectRoot() / "build" / "string.pcm"};
+
+        {
+            abuild::ArtifactStore store{testProject.projectRoot() / "store", 1024};
+            expect(store.size()).toBe(0u);
+            assert_(store.store("0123456789abcdef", outputs)).toBe(true);
+            expect(store.size()).toBe(12u);
+        }
+
+        abuild::ArtifactStore store{testProject.projectRoot() / "store", 1024};
+        expect(store.size()).toBe(12u);
+    });
+
+    test("evicts least recently used", [] {
+        TestProjectWithContent testProject{"abuild_artifact_store_test",
+                                           {{"build/a.o", std::string(40, 'a')},
+                                            {"build/b.o", std::string(40, 'b')},
+                                            {"build/c.o", std::string(40, 'c')}}};
+        abuild::ArtifactStore store{testProject.projectRoot() / "store", 100};
+        const std::filesystem::path a = testProject.projectRoot() / "build" / "a.o";
+        const std::filesystem::path b = testProject.projectRoot() / "build" / "b.o";
+        const std::filesystem::path c = testProject.projectRoot() / "build" / "c.o";
+
+        assert_(store.store("aaaa", {a})).toBe(true);
+        assert_(store.store("bbbb", {b})).toBe(true);
+        std::filesystem::last_write_time(store.root() / "aa" / "aaaa", std::filesystem::file_time_type::clock::now() - std::chrono::hours{2});
+        std::filesystem::last_write_time(store.root() / "bb" / "bbbb", std::filesystem::file_time_type::clock::now() - std::chrono::hours{1});
+        assert_(store.fetch("aaaa", {a})).toBe(true);
+        assert_(store.store("cccc", {c})).toBe(true);
+
+        expect(store.size() <= 100u).toBe(true);
+        expect(store.fetch("aaaa", {a})).toBe(true);
+        expect(store.fetch("bbbb", {b})).toBe(false);
+        expect(store.fetch("cccc", {c})).toBe(true);
+    });
+});
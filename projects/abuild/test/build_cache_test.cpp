@@ -44,6 +44,49 @@ static const auto testSuite = suite("abuild::BuildCache", [] {
         expect(cache.warnings()[0].what).toBe("Some warning");
     });
 
+    test("allocation statistics", [] {
+        TestProjectWithContent testProject{"abuild_build_cache_test",
+                                           {{"main.cpp", "#include \"header.hpp\"\n#include \"some/fairly/long/path/to/header.hpp\""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+
+        abuild::Source *source = cache.sources()[0];
+        abuild::BuildTask *compile = cache.addBuildTask(source, abuild::CompileSourceTask{.source = source});
+        abuild::BuildTask *link = cache.addBuildTask(source->project(), abuild::LinkExecutableTask{.project = source->project()});
+        std::get<abuild::LinkExecutableTask>(*link).inputTasks.insert(compile);
+
+        const abuild::AllocationStatistics statistics = cache.allocationStatistics();
+
+        expect(statistics.heapAllocations).toBe(1u);
+        expect(statistics.heapBytes > std::string{"some/fairly/long/path/to/header.hpp"}.size()).toBe(true);
+        expect(std::get<abuild::LinkExecutableTask>(*link).inputTasks.get_allocator().resource() != std::pmr::get_default_resource()).toBe(true);
+        expect(std::get<abuild::CompileSourceTask>(*compile).includePaths.get_allocator().resource()).toBe(std::get<abuild::LinkExecutableTask>(*link).inputTasks.get_allocator().resource());
+    });
+
+    test("allocation statistics without arena", [] {
+        TestProjectWithContent testProject{"abuild_build_cache_test",
+                                           {{"main.cpp", "#include \"header.hpp\""},
+                                            {"header.hpp", "#include <vector>"},
+                                            {"mylib/source.cpp", "#include \"header.hpp\""},
+                                            {"mylib/header.hpp", ""}}};
+
+        abuild::BuildCache pooled{testProject.projectRoot()};
+        abuild::BuildCache heap{testProject.projectRoot(), abuild::Arena::Mode::Heap};
+
+        for (abuild::BuildCache *cache : {&pooled, &heap})
+        {
+            abuild::ProjectScanner{*cache, 1};
+            abuild::CodeScanner{*cache, 1};
+            abuild::DependencyScanner{*cache};
+        }
+
+        expect(heap.allocationStatistics().allocations).toBe(pooled.allocationStatistics().allocations);
+        expect(heap.allocationStatistics().blockAllocations).toBe(heap.allocationStatistics().allocations);
+        expect(pooled.allocationStatistics().blockAllocations < pooled.allocationStatistics().allocations).toBe(true);
+    });
+
     test("project root", [] {
         TestProject testProject{"abuild_build_cache_test", {}};
 
@@ -51,4 +94,242 @@ static const auto testSuite = suite("abuild::BuildCache", [] {
 
         expect(cache.projectRoot()).toBe(testProject.projectRoot());
     });
+
+    test("snapshot", [] {
+        TestProjectWithContent testProject{"abuild_build_cache_test",
+                                           {{"main.cpp", "import mymodule;\n#include \"header.hpp\"\n#include <vector>"},
+                                            {"header.hpp", ""},
+                                            {"mymodule/mymodule.cpp", "export module mymodule;\nexport import : mypartition;"},
+                                            {"mymodule/mypartition.cpp", "export module mymodule : mypartition;"}}};
+
+        const std::filesystem::path snapshot = testProject.projectRoot() / "build" / "abuild.cache";
+
+        {
+            abuild::BuildCache cache{testProject.projectRoot()};
+            abuild::ProjectScanner{cache};
+            abuild::CodeScanner{cache};
+            abuild::DependencyScanner{cache};
+            cache.addToolchain(abuild::Toolchain{.name = "clang", .compiler = "/usr/bin/clang++", .compilerFlags = {"-std=c++20"}});
+            cache.addWarning(abuild::Warning{.component = "BuildCache", .what = "Some warning"});
+            cache.save(snapshot);
+        }
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+
+        assert_(cache.load(snapshot)).toBe(true);
+        assert_(cache.projects().size()).toBe(2u);
+        assert_(cache.sources().size()).toBe(3u);
+        assert_(cache.headers().size()).toBe(1u);
+        assert_(cache.modules().size()).toBe(1u);
+        assert_(cache.toolchains().size()).toBe(1u);
+
+        abuild::Source *source = cache.source("main.cpp");
+        const abuild::Module *mod = cache.cppModule("mymodule");
+
+        assert_(source != nullptr).toBe(true);
+        assert_(mod != nullptr).toBe(true);
+        assert_(source->dependencies().size()).toBe(3u);
+        expect(std::get<abuild::ImportModuleDependency>(source->dependencies()[0]).mod).toBe(mod);
+        expect(std::get<abuild::IncludeLocalHeaderDependency>(source->dependencies()[1]).header).toBe(cache.headers()[0]);
+        expect(std::get<abuild::IncludeSTLHeaderDependency>(source->dependencies()[2]).name).toBe("vector");
+        expect(mod->source).toBe(cache.source("mymodule.cpp"));
+        assert_(mod->partitions.size()).toBe(1u);
+        expect(mod->partitions[0]->name).toBe("mypartition");
+        expect(mod->partitions[0]->mod).toBe(mod);
+        expect(cache.cppModulePartition(cache.source("mypartition.cpp"))).toBe(mod->partitions[0]);
+        expect(cache.header("header.hpp")->project()).toBe(source->project());
+        expect(cache.toolchain("clang")->compiler).toBe(std::filesystem::path{"/usr/bin/clang++"});
+        expect(cache.toolchain("clang")->compilerFlags.contains("-std=c++20")).toBe(true);
+        assert_(cache.warnings().size()).toBe(1u);
+        expect(cache.warnings()[0].what).toBe("Some warning");
+    });
+
+    test("missing snapshot", [] {
+        TestProject testProject{"abuild_build_cache_test", {}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+
+        expect(cache.load(testProject.projectRoot() / "build" / "abuild.cache")).toBe(false);
+    });
+
+    test("snapshot with modified file", [] {
+        TestProjectWithContent testProject{"abuild_build_cache_test",
+                                           {{"main.cpp", "#include \"header.hpp\""},
+                                            {"header.hpp", ""}}};
+
+        const std::filesystem::path snapshot = testProject.projectRoot() / "build" / "abuild.cache";
+
+        {
+            abuild::BuildCache cache{testProject.projectRoot()};
+            abuild::ProjectScanner{cache};
+            abuild::CodeScanner{cache};
+            cache.save(snapshot);
+        }
+
+        std::filesystem::last_write_time(testProject.projectRoot() / "header.hpp", std::filesystem::last_write_time(testProject.projectRoot() / "header.hpp") + std::chrono::hours{1});
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+
+        assert_(cache.load(snapshot)).toBe(true);
+        expect(cache.header("header.hpp")->isModified()).toBe(true);
+        expect(cache.source("main.cpp")->isModified()).toBe(false);
+    });
+
+    test("snapshot with new directory content", [] {
+        TestProjectWithContent testProject{"abuild_build_cache_test",
+                                           {{"src/main.cpp", ""}}};
+
+        const std::filesystem::path snapshot = testProject.projectRoot() / "build" / "abuild.cache";
+
+        {
+            abuild::BuildCache cache{testProject.projectRoot()};
+            abuild::ProjectScanner{cache};
+            cache.save(snapshot);
+        }
+
+        std::filesystem::last_write_time(testProject.projectRoot() / "src", std::filesystem::last_write_time(testProject.projectRoot() / "src") + std::chrono::hours{1});
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+
+        expect(cache.load(snapshot)).toBe(false);
+    });
+
+    test("snapshot with new file in empty directory", [] {
+        TestProjectWithContent testProject{"abuild_build_cache_test",
+                                           {{"main.cpp", ""}}};
+
+        const std::filesystem::path snapshot = testProject.projectRoot() / "build" / "abuild.cache";
+        std::filesystem::create_directory(testProject.projectRoot() / "newdir");
+
+        {
+            abuild::BuildCache cache{testProject.projectRoot()};
+            abuild::ProjectScanner{cache};
+            cache.save(snapshot);
+        }
+
+        {
+            abuild::BuildCache cache{testProject.projectRoot()};
+            assert_(cache.load(snapshot)).toBe(true);
+            cache.save(snapshot);
+        }
+
+        std::ofstream{testProject.projectRoot() / "newdir" / "x.cpp"};
+        std::filesystem::last_write_time(testProject.projectRoot() / "newdir", std::filesystem::last_write_time(testProject.projectRoot() / "newdir") + std::chrono::hours{1});
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+
+        expect(cache.load(snapshot)).toBe(false);
+    });
+
+    test("snapshot with task durations", [] {
+        TestProjectWithContent testProject{"abuild_build_cache_test",
+                                           {{"src/main.cpp", ""}}};
+
+        const std::filesystem::path snapshot = testProject.projectRoot() / "build" / "abuild.cache";
+
+        {
+            abuild::BuildCache cache{testProject.projectRoot()};
+            abuild::ProjectScanner{cache};
+            abuild::BuildGraph{cache};
+            cache.setTaskDuration(*cache.buildTask(cache.source("main.cpp")), std::chrono::milliseconds{1500});
+            cache.save(snapshot);
+        }
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+
+        assert_(cache.load(snapshot)).toBe(true);
+        abuild::BuildGraph{cache};
+
+        expect(cache.taskName(*cache.buildTask(cache.source("main.cpp")))).toBe("compile src/main.cpp");
+        expect(cache.taskDuration(*cache.buildTask(cache.source("main.cpp"))) == std::chrono::milliseconds{1500}).toBe(true);
+        expect(cache.taskDuration(*cache.buildTask(cache.projects()[0])).has_value()).toBe(false);
+
+        std::filesystem::last_write_time(testProject.projectRoot() / "src", std::filesystem::last_write_time(testProject.projectRoot() / "src") + std::chrono::hours{1});
+
+        abuild::BuildCache outdatedCache{testProject.projectRoot()};
+
+        expect(outdatedCache.load(snapshot)).toBe(false);
+        expect(outdatedCache.taskDurations().size()).toBe(1u);
+    });
+
+    test("snapshot with task states", [] {
+        TestProjectWithContent testProject{"abuild_build_cache_test",
+                                           {{"src/main.cpp", ""}}};
+
+        const std::filesystem::path snapshot = testProject.projectRoot() / "build" / "abuild.cache";
+        const abuild::TaskState state{.fingerprint = {.low = 42, .high = 43}, .outputHash = {.low = 7, .high = 8}, .interfaceHash = {.low = 9, .high = 10}, .outputs = {abuild::FileStatus{.timestamp = 1, .size = 2, .device = 3, .inode = 4}}};
+
+        {
+            abuild::BuildCache cache{testProject.projectRoot()};
+            abuild::ProjectScanner{cache};
+            abuild::BuildGraph{cache};
+            cache.setTaskState(*cache.buildTask(cache.source("main.cpp")), state);
+            cache.save(snapshot);
+        }
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+
+        assert_(cache.load(snapshot)).toBe(true);
+        abuild::BuildGraph{cache};
+
+        assert_(cache.taskState(*cache.buildTask(cache.source("main.cpp"))) != nullptr).toBe(true);
+        expect(*cache.taskState(*cache.buildTask(cache.source("main.cpp"))) == state).toBe(true);
+        expect(cache.taskState(*cache.buildTask(cache.projects()[0])) == nullptr).toBe(true);
+
+        std::filesystem::last_write_time(testProject.projectRoot() / "src", std::filesystem::last_write_time(testProject.projectRoot() / "src") + std::chrono::hours{1});
+
+        abuild::BuildCache outdatedCache{testProject.projectRoot()};
+
+        expect(outdatedCache.load(snapshot)).toBe(false);
+        expect(outdatedCache.taskStates().size()).toBe(1u);
+    });
+
+    test("changed files", [] {
+        TestProjectWithContent testProject{"abuild_build_cache_test",
+                                           {{"main.cpp", ""},
+                                            {"other.cpp", ""},
+                                            {"header.hpp", ""},
+                                            {"removed.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+
+        expect(cache.changedFiles().sources.size()).toBe(0u);
+
+        std::filesystem::last_write_time(testProject.projectRoot() / "other.cpp", std::filesystem::last_write_time(testProject.projectRoot() / "other.cpp") + std::chrono::milliseconds{1});
+        std::ofstream{testProject.projectRoot() / "header.hpp"} << "#pragma once";
+        std::filesystem::remove(testProject.projectRoot() / "removed.hpp");
+
+        const abuild::ChangedFiles changes = cache.changedFiles(2);
+
+        assert_(changes.sources.size()).toBe(1u);
+        expect(changes.sources[0]).toBe(cache.source("other.cpp"));
+        assert_(changes.headers.size()).toBe(1u);
+        expect(changes.headers[0]).toBe(cache.header("header.hpp"));
+        assert_(changes.removed.size()).toBe(1u);
+        expect(changes.removed[0]->name()).toBe("removed.hpp");
+    });
+
+    test("changed files in parallel", [] {
+        std::vector<std::pair<std::filesystem::path, std::string>> files;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            files.emplace_back("src/file" + std::to_string(i) + ".cpp", "");
+        }
+
+        TestProjectWithContent testProject{"abuild_build_cache_test", files};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+
+        const std::filesystem::path path = testProject.projectRoot() / "src" / "file777.cpp";
+        std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::hours{1});
+
+        const abuild::ChangedFiles changes = cache.changedFiles(4);
+
+        assert_(changes.sources.size()).toBe(1u);
+        expect(changes.sources[0]->path()).toBe(path);
+        expect(changes.removed.size()).toBe(0u);
+    });
 });
@@ -0,0 +1,432 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+#ifndef _WIN32
+[[nodiscard]] auto commandToolchain(const std::filesystem::path &command) -> abuild::Toolchain
+{
+    return abuild::Toolchain{
+        .name = "test",
+        .type = abuild::Toolchain::Type::Clang,
+        .compiler = command,
+        .linker = command,
+        .archiver = command};
+}
+
+[[nodiscard]] auto countLines(const std::filesystem::path &path) -> std::size_t
+{
+    std::ifstream file{path};
+    return static_cast<std::size_t>(std::count(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}, '\n'));
+}
+
+static const auto testSuite = suite("abuild::BuildExecutor", [] {
+    test("no tasks", [] {
+        TestProjectWithContent testProject{"abuild_build_executor_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"\" } }"},
+                                            {"header.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::Toolchain toolchain = commandToolchain("/bin/true");
+        const abuild::BuildExecutor executor{cache, toolchain};
+
+        expect(executor.executedTasks()).toBe(0u);
+        expect(executor.failedTasks()).toBe(0u);
+    });
+
+    test("executes all tasks", [] {
+        TestProjectWithContent compiler{"abuild_build_executor_compiler",
+                                        {{"compiler.sh", "#!/bin/sh\nwhile [ $# -gt 0 ]; do\n  if [ \"$1\" = \"-o\" ] || [ \"$1\" = \"rcs\" ]; then mkdir -p \"$(dirname \"$2\")\" && echo output > \"$2\"; fi\n  shift\ndone\n"}}};
+        std::filesystem::permissions(compiler.projectRoot() / "compiler.sh", std::filesystem::perms::owner_all);
+        TestProjectWithContent testProject{"abuild_build_executor_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"\" } }"},
+                                            {"main.cpp", "#include \"header.hpp\"\nimport mylib;"},
+                                            {"header.hpp", ""},
+                                            {"mylib/mylib.cpp", "export module mylib;"},
+                                            {"mylib/source.cpp", "module mylib;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::Toolchain toolchain = commandToolchain(compiler.projectRoot() / "compiler.sh");
+        const abuild::BuildExecutor executor{cache, toolchain, 4};
+
+        assert_(cache.buildTasks().size() > 2u).toBe(true);
+        expect(executor.executedTasks()).toBe(cache.buildTasks().size());
+        expect(executor.failedTasks()).toBe(0u);
+        expect(cache.errors().size()).toBe(0u);
+        expect(std::filesystem::exists(testProject.projectRoot() / "build" / "test" / "obj")).toBe(true);
+    });
+
+    test("failed task stops dependents", [] {
+        TestProjectWithContent testProject{"abuild_build_executor_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"\" } }"},
+                                            {"main.cpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::Toolchain toolchain = commandToolchain("/bin/false");
+        const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+        assert_(cache.buildTasks().size()).toBe(2u);
+        expect(executor.executedTasks()).toBe(0u);
+        expect(executor.failedTasks()).toBe(1u);
+        assert_(cache.errors().size()).toBe(1u);
+        expect(cache.errors()[0].component).toBe("BuildExecutor");
+    });
+
+    test("fetches STL header unit from store", [] {
+        TestProject store{"abuild_build_executor_store", {}};
+        TestProjectWithContent compiler{"abuild_build_executor_compiler",
+                                        {{"compiler.sh", "#!/bin/sh\necho \"$@\" >> \"$(dirname \"$0\")/log\"\nwhile [ $# -gt 0 ]; do\n  if [ \"$1\" = \"-o\" ]; then mkdir -p \"$(dirname \"$2\")\" && echo bmi > \"$2\"; fi\n  shift\ndone\n"}}};
+        std::filesystem::permissions(compiler.projectRoot() / "compiler.sh", std::filesystem::perms::owner_all);
+        const abuild::Toolchain toolchain = commandToolchain(compiler.projectRoot() / "compiler.sh");
+        const std::string settings = "{ \"settings\": { \"storeDirectory\": \"" + store.projectRoot().generic_string() + "\" } }";
+
+        {
+            TestProjectWithContent testProject{"abuild_build_executor_test",
+                                               {{".abuild", settings},
+                                                {"main.cpp", "import <vector>;"}}};
+
+            abuild::BuildCache cache{testProject.projectRoot()};
+            abuild::ProjectScanner{cache};
+            abuild::CodeScanner{cache};
+            abuild::DependencyScanner{cache};
+            abuild::BuildGraph{cache};
+
+            const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+            assert_(cache.buildTask("vector") != nullptr).toBe(true);
+            expect(executor.executedTasks()).toBe(cache.buildTasks().size());
+            expect(executor.fetchedTasks()).toBe(0u);
+            expect(countLines(compiler.projectRoot() / "log")).toBe(cache.buildTasks().size());
+        }
+
+        std::filesystem::remove(compiler.projectRoot() / "log");
+
+        TestProjectWithContent testProject{"abuild_build_executor_test_other",
+                                           {{".abuild", settings},
+                                            {"main.cpp", "import <vector>;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+        expect(executor.executedTasks()).toBe(cache.buildTasks().size());
+        expect(executor.fetchedTasks()).toBe(1u);
+        expect(countLines(compiler.projectRoot() / "log")).toBe(cache.buildTasks().size() - 1);
+    });
+
+    test("fetches compiled tasks from store", [] {
+        TestProject store{"abuild_build_executor_store", {}};
+        TestProjectWithContent compiler{"abuild_build_executor_compiler",
+                                        {{"compiler.sh", "#!/bin/sh\necho \"$@\" >> \"$(dirname \"$0\")/log\"\nwhile [ $# -gt 0 ]; do\n  if [ \"$1\" = \"-o\" ] || [ \"$1\" = \"rcs\" ]; then mkdir -p \"$(dirname \"$2\")\" && echo output > \"$2\"; fi\n  shift\ndone\n"}}};
+        std::filesystem::permissions(compiler.projectRoot() / "compiler.sh", std::filesystem::perms::owner_all);
+        const abuild::Toolchain toolchain = commandToolchain(compiler.projectRoot() / "compiler.sh");
+        TestProjectWithContent testProject{"abuild_build_executor_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"" + store.projectRoot().generic_string() + "\" } }"},
+                                            {"main.cpp", "#include \"header.hpp\"\nimport mylib;"},
+                                            {"other.cpp", ""},
+                                            {"header.hpp", ""},
+                                            {"mylib/mylib.cpp", "export module mylib;"}}};
+
+        const auto build = [&] {
+            abuild::BuildCache cache{testProject.projectRoot()};
+            abuild::ProjectScanner{cache};
+            abuild::CodeScanner{cache};
+            abuild::DependencyScanner{cache};
+            abuild::BuildGraph{cache};
+
+            const abuild::BuildExecutor executor{cache, toolchain, 2};
+            expect(executor.executedTasks()).toBe(cache.buildTasks().size());
+            return executor.fetchedTasks();
+        };
+
+        expect(build()).toBe(0u);
+        std::filesystem::remove_all(testProject.projectRoot() / "build");
+        expect(build()).toBe(3u);
+
+        std::ofstream{testProject.projectRoot() / "header.hpp"} << "int i = 0;";
+        expect(build()).toBe(2u);
+
+        std::ofstream{testProject.projectRoot() / "mylib" / "mylib.cpp"} << "export module mylib;\nexport int j = 0;";
+        expect(build()).toBe(2u);
+    });
+
+    test("shares system only header units across checkouts", [] {
+        TestProject store{"abuild_build_executor_store", {}};
+        TestProjectWithContent compiler{"abuild_build_executor_compiler",
+                                        {{"compiler.sh", "#!/bin/sh\necho \"$@\" >> \"$(dirname \"$0\")/log\"\nwhile [ $# -gt 0 ]; do\n  if [ \"$1\" = \"-o\" ] || [ \"$1\" = \"rcs\" ]; then mkdir -p \"$(dirname \"$2\")\" && echo output > \"$2\"; fi\n  shift\ndone\n"}}};
+        std::filesystem::permissions(compiler.projectRoot() / "compiler.sh", std::filesystem::perms::owner_all);
+        TestProjectWithContent stl{"abuild_build_executor_stl",
+                                   {{"vector", "#include <bits/allocator.h>"},
+                                    {"bits/allocator.h", ""}}};
+        abuild::Toolchain toolchain = commandToolchain(compiler.projectRoot() / "compiler.sh");
+        toolchain.systemIncludePaths = {stl.projectRoot()};
+        const std::string settings = "{ \"settings\": { \"storeDirectory\": \"" + store.projectRoot().generic_string() + "\" } }";
+
+        const auto build = [&](const std::string &name, const std::string &local) {
+            TestProjectWithContent testProject{name,
+                                               {{".abuild", settings},
+                                                {"header.hpp", "#include <vector>\n" + local},
+                                                {"local.hpp", ""},
+                                                {"user.cpp", "import \"header.hpp\";"}}};
+
+            abuild::BuildCache cache{testProject.projectRoot()};
+            abuild::ProjectScanner{cache};
+            abuild::CodeScanner{cache};
+            abuild::DependencyScanner{cache};
+            abuild::BuildGraph{cache};
+
+            const abuild::BuildExecutor executor{cache, toolchain, 2};
+            expect(executor.executedTasks()).toBe(cache.buildTasks().size());
+            return executor.fetchedTasks();
+        };
+
+        expect(build("abuild_build_executor_checkout1", "")).toBe(0u);
+        expect(build("abuild_build_executor_checkout2", "")).toBe(1u);
+
+        expect(build("abuild_build_executor_checkout3", "#include \"local.hpp\"")).toBe(0u);
+        expect(build("abuild_build_executor_checkout4", "#include \"local.hpp\"")).toBe(0u);
+    });
+
+    test("skips up to date tasks", [] {
+        TestProjectWithContent compiler{"abuild_build_executor_compiler",
+                                        {{"compiler.sh", "#!/bin/sh\necho \"$@\" >> \"$(dirname \"$0\")/log\"\nwhile [ $# -gt 0 ]; do\n  if [ \"$1\" = \"-o\" ]; then mkdir -p \"$(dirname \"$2\")\" && echo $$ > \"$2\"; fi\n  shift\ndone\n"}}};
+        std::filesystem::permissions(compiler.projectRoot() / "compiler.sh", std::filesystem::perms::owner_all);
+        const abuild::Toolchain toolchain = commandToolchain(compiler.projectRoot() / "compiler.sh");
+        TestProjectWithContent testProject{"abuild_build_executor_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"\" } }"},
+                                            {"main.cpp", "#include \"header.hpp\""},
+                                            {"other.cpp", ""},
+                                            {"header.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        {
+            const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+            assert_(executor.executedTasks()).toBe(3u);
+            expect(executor.upToDateTasks()).toBe(0u);
+            expect(countLines(compiler.projectRoot() / "log")).toBe(3u);
+        }
+
+        {
+            const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+            expect(executor.executedTasks()).toBe(3u);
+            expect(executor.upToDateTasks()).toBe(3u);
+            expect(countLines(compiler.projectRoot() / "log")).toBe(3u);
+        }
+
+        std::ofstream{testProject.projectRoot() / "header.hpp"} << "int i = 0;";
+        abuild::IncrementalScanner{cache};
+
+        {
+            const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+            expect(executor.executedTasks()).toBe(3u);
+            expect(executor.upToDateTasks()).toBe(1u);
+            expect(countLines(compiler.projectRoot() / "log")).toBe(5u);
+        }
+
+        std::filesystem::remove(testProject.projectRoot() / "build" / "test" / "obj" / "other.cpp.o");
+        const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+        expect(executor.executedTasks()).toBe(3u);
+        expect(executor.upToDateTasks()).toBe(1u);
+        expect(countLines(compiler.projectRoot() / "log")).toBe(7u);
+    });
+
+    test("rebuilds STL header unit when system header changes", [] {
+        TestProjectWithContent compiler{"abuild_build_executor_compiler",
+                                        {{"compiler.sh", "#!/bin/sh\necho \"$@\" >> \"$(dirname \"$0\")/log\"\nwhile [ $# -gt 0 ]; do\n  if [ \"$1\" = \"-o\" ]; then mkdir -p \"$(dirname \"$2\")\" && echo output > \"$2\"; fi\n  shift\ndone\n"}}};
+        std::filesystem::permissions(compiler.projectRoot() / "compiler.sh", std::filesystem::perms::owner_all);
+        TestProjectWithContent stl{"abuild_build_executor_stl",
+                                   {{"vector", "#include <bits/vector.h>"},
+                                    {"bits/vector.h", "#include \"allocator.h\""},
+                                    {"bits/allocator.h", ""}}};
+        abuild::Toolchain toolchain = commandToolchain(compiler.projectRoot() / "compiler.sh");
+        toolchain.systemIncludePaths = {stl.projectRoot()};
+        TestProjectWithContent testProject{"abuild_build_executor_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"\" } }"},
+                                            {"main.cpp", "import <vector>;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        {
+            const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+            assert_(executor.executedTasks()).toBe(3u);
+            expect(countLines(compiler.projectRoot() / "log")).toBe(3u);
+        }
+
+        {
+            const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+            expect(executor.upToDateTasks()).toBe(3u);
+            expect(countLines(compiler.projectRoot() / "log")).toBe(3u);
+        }
+
+        std::ofstream{stl.projectRoot() / "bits" / "allocator.h"} << "namespace std {}";
+        const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+        expect(executor.upToDateTasks()).toBe(2u);
+        expect(executor.cutOffTasks()).toBe(1u);
+        expect(countLines(compiler.projectRoot() / "log")).toBe(4u);
+    });
+
+    test("gate task runs before lower priority tasks of other workers", [] {
+        TestProjectWithContent compiler{"abuild_build_executor_compiler",
+                                        {{"compiler.sh", "#!/bin/sh\nfor arg in \"$@\"; do\n  case \"$arg\" in\n    *.cpp|*.hpp) echo \"$(basename \"$arg\")\" >> \"$(dirname \"$0\")/log\"; source=\"$arg\" ;;\n  esac\ndone\ncase \"$source\" in\n  *low*) sleep 0.3 ;;\n  *busy*) sleep 0.6 ;;\nesac\nwhile [ $# -gt 0 ]; do\n  if [ \"$1\" = \"-o\" ] || [ \"$1\" = \"rcs\" ]; then mkdir -p \"$(dirname \"$2\")\" && echo output > \"$2\"; fi\n  shift\ndone\n"}}};
+        std::filesystem::permissions(compiler.projectRoot() / "compiler.sh", std::filesystem::perms::owner_all);
+        const abuild::Toolchain toolchain = commandToolchain(compiler.projectRoot() / "compiler.sh");
+        TestProjectWithContent testProject{"abuild_build_executor_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"\" } }"},
+                                            {"base.cpp", "export module base;"},
+                                            {"busy.cpp", "export module busy;\nimport base;"},
+                                            {"gate.cpp", "export module gate;\nimport base;"},
+                                            {"user1.cpp", "import busy;"},
+                                            {"user2.cpp", "import busy;\nimport gate;"},
+                                            {"low1.cpp", ""},
+                                            {"low2.cpp", ""},
+                                            {"low3.cpp", ""},
+                                            {"low4.cpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        {
+            const abuild::BuildExecutor executor{cache, toolchain, 2, abuild::SchedulingPolicy::ModulesFirst};
+
+            assert_(executor.executedTasks()).toBe(cache.buildTasks().size());
+        }
+
+        std::vector<std::string> order;
+        std::ifstream log{compiler.projectRoot() / "log"};
+
+        for (std::string line; std::getline(log, line);)
+        {
+            if (std::find(order.begin(), order.end(), line) == order.end())
+            {
+                order.push_back(line);
+            }
+        }
+
+        const std::vector<std::string>::const_iterator gate = std::find(order.begin(), order.end(), "gate.cpp");
+
+        assert_(gate != order.end()).toBe(true);
+        expect(std::count_if(order.cbegin(), gate, [](const std::string &name) { return name.starts_with("low"); })).toBe(1);
+    });
+
+    test("missing BMI fails the task", [] {
+        TestProjectWithContent compiler{"abuild_build_executor_compiler",
+                                        {{"compiler.sh", "#!/bin/sh\nwhile [ $# -gt 0 ]; do\n  case \"$1\" in\n    -o|rcs) output=\"$2\"; shift ;;\n  esac\n  shift\ndone\nmkdir -p \"$(dirname \"$output\")\"\ncase \"$output\" in\n  *.pcm) ;;\n  *) echo $$ > \"$output\" ;;\nesac\n"}}};
+        std::filesystem::permissions(compiler.projectRoot() / "compiler.sh", std::filesystem::perms::owner_all);
+        const abuild::Toolchain toolchain = commandToolchain(compiler.projectRoot() / "compiler.sh");
+        TestProjectWithContent testProject{"abuild_build_executor_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"\" } }"},
+                                            {"main.cpp", "import mylib;"},
+                                            {"mylib/mylib.cpp", "export module mylib;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+        expect(executor.failedTasks()).toBe(1u);
+        expect(executor.executedTasks()).toBe(0u);
+        expect(cache.taskStates().empty()).toBe(true);
+        assert_(cache.errors().size()).toBe(1u);
+        expect(cache.errors()[0].what.find("mylib.pcm' was not produced") != std::string::npos).toBe(true);
+    });
+
+    test("early cutoff when BMI is unchanged", [] {
+        TestProjectWithContent compiler{"abuild_build_executor_compiler",
+                                        {{"compiler.sh", "#!/bin/sh\nwhile [ $# -gt 0 ]; do\n  case \"$1\" in\n    *.cpp) source=\"$1\" ;;\n    -o|rcs) output=\"$2\"; shift ;;\n  esac\n  shift\ndone\nmkdir -p \"$(dirname \"$output\")\"\ncase \"$output\" in\n  *.pcm) grep export \"$source\" > \"$output\" ;;\n  *) echo $$ > \"$output\" ;;\nesac\n"}}};
+        std::filesystem::permissions(compiler.projectRoot() / "compiler.sh", std::filesystem::perms::owner_all);
+        const abuild::Toolchain toolchain = commandToolchain(compiler.projectRoot() / "compiler.sh");
+        TestProjectWithContent testProject{"abuild_build_executor_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"\" } }"},
+                                            {"main.cpp", "import mylib;"},
+                                            {"mylib/mylib.cpp", "export module mylib;\nexport int f();\nint f() { return 1; }"}}};
+        const std::filesystem::path object = testProject.projectRoot() / "build" / "test" / "obj" / "main.cpp.o";
+
+        const auto scan = [&](abuild::BuildCache &cache) {
+            abuild::ProjectScanner{cache};
+            abuild::CodeScanner{cache};
+            abuild::DependencyScanner{cache};
+            abuild::BuildGraph{cache};
+        };
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        scan(cache);
+
+        {
+            const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+            assert_(executor.executedTasks()).toBe(cache.buildTasks().size());
+            expect(executor.upToDateTasks()).toBe(0u);
+        }
+
+        const std::filesystem::file_time_type built = std::filesystem::last_write_time(object);
+        std::ofstream{testProject.projectRoot() / "mylib" / "mylib.cpp"} << "export module mylib;\nexport int f();\nint f() { return 10; }";
+        abuild::BuildCache edited{testProject.projectRoot()};
+        edited.setTaskStates(cache.taskStates());
+        scan(edited);
+
+        {
+            const abuild::BuildExecutor executor{edited, toolchain, 2};
+
+            expect(executor.executedTasks()).toBe(edited.buildTasks().size());
+            expect(executor.cutOffTasks()).toBe(1u);
+            expect(std::filesystem::last_write_time(object) == built).toBe(true);
+        }
+
+        std::ofstream{testProject.projectRoot() / "mylib" / "mylib.cpp"} << "export module mylib;\nexport int f(int i);\nint f(int i) { return i; }";
+        abuild::BuildCache changed{testProject.projectRoot()};
+        changed.setTaskStates(edited.taskStates());
+        scan(changed);
+        const abuild::BuildExecutor executor{changed, toolchain, 2};
+
+        expect(executor.executedTasks()).toBe(changed.buildTasks().size());
+        expect(executor.cutOffTasks()).toBe(0u);
+        expect(executor.upToDateTasks()).toBe(0u);
+        expect(std::filesystem::last_write_time(object) == built).toBe(false);
+    });
+});
+#endif
@@ -7,15 +7,15 @@ using atest::expect_fail;
 using atest::suite;
 using atest::test;
 
-[[nodiscard]] auto findProject(const std::vector<std::unique_ptr<abuild::Project>> &projects, const std::string &name) -> abuild::Project *
+[[nodiscard]] auto findProject(const std::vector<abuild::Project *> &projects, const std::string &name) -> abuild::Project *
 {
     auto it = std::find_if(projects.begin(),
                            projects.end(),
-                           [&](const std::unique_ptr<abuild::Project> &project) {
+                           [&](abuild::Project *project) {
                                return project->name() == name;
                            });
 
-    return it != projects.end() ? it->get() : nullptr;
+    return it != projects.end() ? *it : nullptr;
 };
 
 static const auto testSuite = suite("abuild::BuildGraph", [] {
@@ -46,8 +46,8 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         assert_(cache.sources().size()).toBe(1u);
         assert_(cache.projects().size()).toBe(1u);
 
-        const abuild::BuildTask *linkTask = cache.buildTask(cache.projects()[0].get());
-        const abuild::BuildTask *compileTask = cache.buildTask(cache.sources()[0].get());
+        const abuild::BuildTask *linkTask = cache.buildTask(cache.projects()[0]);
+        const abuild::BuildTask *compileTask = cache.buildTask(cache.sources()[0]);
 
         assert_(linkTask != nullptr).toBe(true);
         assert_(compileTask != nullptr).toBe(true);
@@ -55,8 +55,8 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         const abuild::LinkExecutableTask *link = &std::get<abuild::LinkExecutableTask>(*linkTask);
         const abuild::CompileSourceTask *compile = &std::get<abuild::CompileSourceTask>(*compileTask);
 
-        expect(link->project).toBe(cache.projects()[0].get());
-        expect(compile->source).toBe(cache.sources()[0].get());
+        expect(link->project).toBe(cache.projects()[0]);
+        expect(compile->source).toBe(cache.sources()[0]);
 
         assert_(link->inputTasks.size()).toBe(1u);
         expect(*link->inputTasks.begin()).toBe(compileTask);
@@ -75,8 +75,8 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         assert_(cache.sources().size()).toBe(1u);
         assert_(cache.projects().size()).toBe(1u);
 
-        const abuild::BuildTask *linkTask = cache.buildTask(cache.projects()[0].get());
-        const abuild::BuildTask *compileTask = cache.buildTask(cache.sources()[0].get());
+        const abuild::BuildTask *linkTask = cache.buildTask(cache.projects()[0]);
+        const abuild::BuildTask *compileTask = cache.buildTask(cache.sources()[0]);
 
         assert_(linkTask != nullptr).toBe(true);
         assert_(compileTask != nullptr).toBe(true);
@@ -84,8 +84,8 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         const abuild::LinkLibraryTask *link = &std::get<abuild::LinkLibraryTask>(*linkTask);
         const abuild::CompileSourceTask *compile = &std::get<abuild::CompileSourceTask>(*compileTask);
 
-        expect(link->project).toBe(cache.projects()[0].get());
-        expect(compile->source).toBe(cache.sources()[0].get());
+        expect(link->project).toBe(cache.projects()[0]);
+        expect(compile->source).toBe(cache.sources()[0]);
 
         assert_(link->inputTasks.size()).toBe(1u);
         expect(*link->inputTasks.begin()).toBe(compileTask);
@@ -104,8 +104,8 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         assert_(cache.modules().size()).toBe(1u);
         assert_(cache.sources().size()).toBe(1u);
 
-        const abuild::BuildTask *linkTask = cache.buildTask(cache.modules()[0].get());
-        const abuild::BuildTask *compileTask = cache.buildTask(cache.sources()[0].get());
+        const abuild::BuildTask *linkTask = cache.buildTask(cache.modules()[0]);
+        const abuild::BuildTask *compileTask = cache.buildTask(cache.sources()[0]);
 
         assert_(linkTask != nullptr).toBe(true);
         assert_(compileTask != nullptr).toBe(true);
@@ -113,8 +113,8 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         const abuild::LinkModuleLibraryTask *link = &std::get<abuild::LinkModuleLibraryTask>(*linkTask);
         const abuild::CompileModuleInterfaceTask *compile = &std::get<abuild::CompileModuleInterfaceTask>(*compileTask);
 
-        expect(link->mod).toBe(cache.modules()[0].get());
-        expect(compile->source).toBe(cache.sources()[0].get());
+        expect(link->mod).toBe(cache.modules()[0]);
+        expect(compile->source).toBe(cache.sources()[0]);
 
         assert_(link->inputTasks.size()).toBe(1u);
         expect(*link->inputTasks.begin()).toBe(compileTask);
@@ -152,7 +152,7 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
 
         assert_(cache.modules().size()).toBe(1u);
 
-        abuild::BuildTask *linkTask = cache.buildTask(cache.modules()[0].get());
+        abuild::BuildTask *linkTask = cache.buildTask(cache.modules()[0]);
         abuild::BuildTask *compileModuleTask = cache.buildTask(cache.source("mymodule.cpp"));
         abuild::BuildTask *compilePartitionTask = cache.buildTask(cache.source("mypartition.cpp"));
 
@@ -165,7 +165,7 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         expect(*compile->inputTasks.begin()).toBe(compilePartitionTask);
 
         expect(std::get<abuild::LinkModuleLibraryTask>(*linkTask).inputTasks)
-            .toBe(std::unordered_set<abuild::BuildTask *>{
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
                 compileModuleTask,
                 compilePartitionTask});
     });
@@ -202,11 +202,11 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         expect(linkHeaderOnlyLibraryTask).toBe(nullptr);
 
         expect(std::get<abuild::LinkExecutableTask>(*linkExecutableTask).inputTasks)
-            .toBe(std::unordered_set<abuild::BuildTask *>{
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
                 compileTask,
                 linkLibraryTask});
         expect(std::get<abuild::CompileSourceTask>(*compileTask).includePaths)
-            .toBe(std::unordered_set<std::filesystem::path, abuild::PathHash>{
+            .toBe(abuild::ArenaSet<std::filesystem::path, abuild::PathHash>{
                 testProject.projectRoot() / "mylib",
                 testProject.projectRoot() / "headeronly"});
     });
@@ -243,12 +243,12 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         expect(linkHeaderOnlyLibraryTask).toBe(nullptr);
 
         expect(std::get<abuild::LinkExecutableTask>(*linkExecutableTask).inputTasks)
-            .toBe(std::unordered_set<abuild::BuildTask *>{
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
                 compileTask,
                 linkLibraryTask});
 
         expect(std::get<abuild::CompileSourceTask>(*compileTask).includePaths)
-            .toBe(std::unordered_set<std::filesystem::path, abuild::PathHash>{
+            .toBe(abuild::ArenaSet<std::filesystem::path, abuild::PathHash>{
                 testProject.projectRoot() / "mylib",
                 testProject.projectRoot() / "headeronly"});
     });
@@ -267,8 +267,8 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         assert_(cache.projects().size()).toBe(1u);
         assert_(cache.modules().size()).toBe(1u);
 
-        abuild::BuildTask *linkExecutableTask = cache.buildTask(cache.projects()[0].get());
-        abuild::BuildTask *linkModuleTask = cache.buildTask(cache.modules()[0].get());
+        abuild::BuildTask *linkExecutableTask = cache.buildTask(cache.projects()[0]);
+        abuild::BuildTask *linkModuleTask = cache.buildTask(cache.modules()[0]);
         abuild::BuildTask *compileTask = cache.buildTask(cache.source("main.cpp"));
         abuild::BuildTask *compileModuleTask = cache.buildTask(cache.source("mymodule.cpp"));
 
@@ -281,11 +281,11 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         const auto *link = &std::get<abuild::LinkExecutableTask>(*linkExecutableTask);
 
         expect(compile->inputTasks)
-            .toBe(std::unordered_set<abuild::BuildTask *>{
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
                 compileModuleTask});
 
         expect(link->inputTasks)
-            .toBe(std::unordered_set<abuild::BuildTask *>{
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
                 compileTask,
                 linkModuleTask});
     });
@@ -305,8 +305,8 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         assert_(cache.projects().size()).toBe(1u);
         assert_(cache.modules().size()).toBe(1u);
 
-        abuild::BuildTask *linkExecutableTask = cache.buildTask(cache.projects()[0].get());
-        abuild::BuildTask *linkModuleTask = cache.buildTask(cache.modules()[0].get());
+        abuild::BuildTask *linkExecutableTask = cache.buildTask(cache.projects()[0]);
+        abuild::BuildTask *linkModuleTask = cache.buildTask(cache.modules()[0]);
         abuild::BuildTask *compileTask = cache.buildTask(cache.source("main.cpp"));
         abuild::BuildTask *compileModuleTask = cache.buildTask(cache.source("mymodule.cpp"));
 
@@ -319,15 +319,87 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         const auto *link = &std::get<abuild::LinkExecutableTask>(*linkExecutableTask);
 
         expect(compile->inputTasks)
-            .toBe(std::unordered_set<abuild::BuildTask *>{
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
                 compileModuleTask});
 
         expect(link->inputTasks)
-            .toBe(std::unordered_set<abuild::BuildTask *>{
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
                 compileTask,
                 linkModuleTask});
     });
 
+    test("import module with exported and private imports", [] {
+        TestProjectWithContent testProject{"abuild_build_graph_test",
+                                           {{"main.cpp", "import mymodule;"},
+                                            {"mymodule.cpp", "export module mymodule;\nexport import publicmodule;\nimport privatemodule;"},
+                                            {"publicmodule.cpp", "export module publicmodule;\nexport import <vector>;\nimport <string>;"},
+                                            {"privatemodule.cpp", "export module privatemodule;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        abuild::BuildTask *compileTask = cache.buildTask(cache.source("main.cpp"));
+        abuild::BuildTask *compileModuleTask = cache.buildTask(cache.source("mymodule.cpp"));
+        abuild::BuildTask *compilePublicModuleTask = cache.buildTask(cache.source("publicmodule.cpp"));
+        abuild::BuildTask *compilePrivateModuleTask = cache.buildTask(cache.source("privatemodule.cpp"));
+        abuild::BuildTask *compileVectorTask = cache.buildTask("vector");
+        abuild::BuildTask *compileStringTask = cache.buildTask("string");
+
+        assert_(compileTask != nullptr).toBe(true);
+        assert_(compileModuleTask != nullptr).toBe(true);
+        assert_(compilePublicModuleTask != nullptr).toBe(true);
+        assert_(compilePrivateModuleTask != nullptr).toBe(true);
+        assert_(compileVectorTask != nullptr).toBe(true);
+        assert_(compileStringTask != nullptr).toBe(true);
+
+        expect(std::get<abuild::CompileSourceTask>(*compileTask).inputTasks)
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
+                compileModuleTask,
+                compilePublicModuleTask,
+                compileVectorTask});
+
+        expect(std::get<abuild::CompileModuleInterfaceTask>(*compileModuleTask).inputTasks)
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
+                compilePublicModuleTask,
+                compilePrivateModuleTask,
+                compileVectorTask});
+
+        expect(std::get<abuild::CompileModuleInterfaceTask>(*compilePublicModuleTask).inputTasks)
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
+                compileVectorTask,
+                compileStringTask});
+    });
+
+    test("import module with exported partition", [] {
+        TestProjectWithContent testProject{"abuild_build_graph_test",
+                                           {{"main.cpp", "import mymodule;"},
+                                            {"mymodule.cpp", "export module mymodule;\nexport import : mypartition;\nimport : myimplementation;"},
+                                            {"mypartition.cpp", "export module mymodule : mypartition;"},
+                                            {"myimplementation.cpp", "module mymodule : myimplementation;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        abuild::BuildTask *compileTask = cache.buildTask(cache.source("main.cpp"));
+        abuild::BuildTask *compileModuleTask = cache.buildTask(cache.source("mymodule.cpp"));
+        abuild::BuildTask *compilePartitionTask = cache.buildTask(cache.source("mypartition.cpp"));
+
+        assert_(compileTask != nullptr).toBe(true);
+        assert_(compileModuleTask != nullptr).toBe(true);
+        assert_(compilePartitionTask != nullptr).toBe(true);
+
+        expect(std::get<abuild::CompileSourceTask>(*compileTask).inputTasks)
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
+                compileModuleTask,
+                compilePartitionTask});
+    });
+
     test("import header", [] {
         TestProjectWithContent testProject{"abuild_build_graph_test",
                                            {{"main.cpp", "import <mylib.hpp>;"},
@@ -372,12 +444,12 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         const auto *compileOtherLib = &std::get<abuild::CompileSourceTask>(*compileOtherLibTask);
         const auto *linkOtherLib = &std::get<abuild::LinkLibraryTask>(*linkOtherLibTask);
 
-        expect(compileMain->inputTasks).toBe(std::unordered_set<abuild::BuildTask *>{compileMyLibHppTask});
-        expect(linkExe->inputTasks).toBe(std::unordered_set<abuild::BuildTask *>{compileMainTask, linkMyLibTask});
-        expect(compileMyLibHeaderUnit->inputTasks).toBe(std::unordered_set<abuild::BuildTask *>{compileOtherLibHppTask});
-        expect(linkMyLib->inputTasks).toBe(std::unordered_set<abuild::BuildTask *>{linkOtherLibTask, compileMyLibHppTask});
-        expect(compileOtherLib->inputTasks).toBe(std::unordered_set<abuild::BuildTask *>{compileOtherLibHppTask});
-        expect(linkOtherLib->inputTasks).toBe(std::unordered_set<abuild::BuildTask *>{compileOtherLibHppTask, compileOtherLibTask});
+        expect(compileMain->inputTasks).toBe(abuild::ArenaSet<abuild::BuildTask *>{compileMyLibHppTask});
+        expect(linkExe->inputTasks).toBe(abuild::ArenaSet<abuild::BuildTask *>{compileMainTask, linkMyLibTask});
+        expect(compileMyLibHeaderUnit->inputTasks).toBe(abuild::ArenaSet<abuild::BuildTask *>{compileOtherLibHppTask});
+        expect(linkMyLib->inputTasks).toBe(abuild::ArenaSet<abuild::BuildTask *>{linkOtherLibTask, compileMyLibHppTask});
+        expect(compileOtherLib->inputTasks).toBe(abuild::ArenaSet<abuild::BuildTask *>{compileOtherLibHppTask});
+        expect(linkOtherLib->inputTasks).toBe(abuild::ArenaSet<abuild::BuildTask *>{compileOtherLibHppTask, compileOtherLibTask});
     });
 
     test("include source", [] {
@@ -401,7 +473,7 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         const auto *compile = &std::get<abuild::CompileModuleInterfaceTask>(*compileTask);
 
         expect(compile->inputTasks)
-            .toBe(std::unordered_set<abuild::BuildTask *>{
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
                 otherCompileTask});
     });
 
@@ -426,7 +498,7 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         const auto *compile = &std::get<abuild::CompileModuleInterfaceTask>(*compileTask);
 
         expect(compile->inputTasks)
-            .toBe(std::unordered_set<abuild::BuildTask *>{
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
                 otherCompileTask});
     });
 
@@ -458,9 +530,9 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         const auto *compile = &std::get<abuild::CompileSourceTask>(*compileTask);
         const auto *link = &std::get<abuild::LinkExecutableTask>(*linkTask);
 
-        expect(compile->inputTasks).toBe(std::unordered_set<abuild::BuildTask *>{});
-        expect(compile->includePaths).toBe(std::unordered_set<std::filesystem::path, abuild::PathHash>{testProject.projectRoot() / "mylib"});
-        expect(link->inputTasks).toBe(std::unordered_set<abuild::BuildTask *>{compileTask});
+        expect(compile->inputTasks).toBe(abuild::ArenaSet<abuild::BuildTask *>{});
+        expect(compile->includePaths).toBe(abuild::ArenaSet<std::filesystem::path, abuild::PathHash>{testProject.projectRoot() / "mylib"});
+        expect(link->inputTasks).toBe(abuild::ArenaSet<abuild::BuildTask *>{compileTask});
     });
 
     test("self include", [] {
@@ -496,6 +568,40 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         expect(compileTask != nullptr).toBe(true);
     });
 
+    test("circular include shared by sources", [] {
+        TestProjectWithContent testProject{"abuild_build_graph_test",
+                                           {{"main.cpp", "#include \"myheader.hpp\""},
+                                            {"other.cpp", "#include \"otherheader.hpp\""},
+                                            {"mylib/myheader.hpp", "#include \"otherheader.hpp\""},
+                                            {"mylib/otherheader.hpp", "#include \"myheader.hpp\"\nimport <vector>;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        abuild::BuildTask *mainTask = cache.buildTask(cache.source("main.cpp"));
+        abuild::BuildTask *otherTask = cache.buildTask(cache.source("other.cpp"));
+        abuild::BuildTask *compileSTLHeaderUnitTask = cache.buildTask("vector");
+
+        assert_(mainTask != nullptr).toBe(true);
+        assert_(otherTask != nullptr).toBe(true);
+        assert_(compileSTLHeaderUnitTask != nullptr).toBe(true);
+
+        for (abuild::BuildTask *task : {mainTask, otherTask})
+        {
+            const auto *compile = &std::get<abuild::CompileSourceTask>(*task);
+
+            expect(compile->inputTasks)
+                .toBe(abuild::ArenaSet<abuild::BuildTask *>{
+                    compileSTLHeaderUnitTask});
+            expect(compile->includePaths)
+                .toBe(abuild::ArenaSet<std::filesystem::path, abuild::PathHash>{
+                    testProject.projectRoot() / "mylib"});
+        }
+    });
+
     test("import STL", [] {
         TestProjectWithContent testProject{"abuild_build_graph_test",
                                            {{"main.cpp", "import <vector>;"}}};
@@ -515,7 +621,7 @@ static const auto testSuite = suite("abuild::BuildGraph", [] {
         const auto *compile = &std::get<abuild::CompileSourceTask>(*compileTask);
 
         expect(compile->inputTasks)
-            .toBe(std::unordered_set<abuild::BuildTask *>{
+            .toBe(abuild::ArenaSet<abuild::BuildTask *>{
                 compileSTLHeaderUnitTask});
     });
 });
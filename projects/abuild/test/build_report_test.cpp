@@ -0,0 +1,176 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+[[nodiscard]] auto reportTaskIndex(const abuild::CompactBuildGraph &graph, const abuild::BuildTask *task) -> std::uint32_t
+{
+    for (std::uint32_t index = 0; index < graph.size(); ++index)
+    {
+        if (graph.task(index) == task)
+        {
+            return index;
+        }
+    }
+
+    return graph.size();
+}
+
+[[nodiscard]] auto findReportProject(const abuild::BuildCache &cache, const std::string &name) -> const abuild::Project *
+{
+    for (abuild::Project *project : cache.projects())
+    {
+        if (project->name() == name)
+        {
+            return project;
+        }
+    }
+
+    return nullptr;
+}
+
+static const auto testSuite = suite("abuild::BuildReport", [] {
+    test("empty", [] {
+        TestProjectWithContent testProject{"abuild_build_report_test",
+                                           {{"header.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::CompactBuildGraph graph{cache};
+        const abuild::BuildReport report{cache, graph};
+
+        expect(report.criticalPath().empty()).toBe(true);
+        expect(report.criticalPathDuration().count()).toBe(0);
+        expect(report.totalWork().count()).toBe(0);
+        expect(report.parallelism()).toBe(0.0);
+        expect(report.projects().empty()).toBe(true);
+    });
+
+    test("critical path", [] {
+        TestProjectWithContent testProject{"abuild_build_report_test",
+                                           {{"main.cpp", "#include <myheader.hpp>"},
+                                            {"mylib/mysource.cpp", ""},
+                                            {"mylib/myheader.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        cache.setTaskDuration(*cache.buildTask(cache.source("main.cpp")), std::chrono::milliseconds{5000});
+        cache.setTaskDuration(*cache.buildTask(cache.source("mysource.cpp")), std::chrono::milliseconds{100});
+        cache.setTaskDuration(*cache.buildTask(findReportProject(cache, "mylib")), std::chrono::milliseconds{100});
+        cache.setTaskDuration(*cache.buildTask(findReportProject(cache, "abuild_build_report_test")), std::chrono::milliseconds{200});
+
+        const abuild::CompactBuildGraph graph{cache};
+        const abuild::BuildReport report{cache, graph};
+
+        const std::uint32_t compileMain = reportTaskIndex(graph, cache.buildTask(cache.source("main.cpp")));
+        const std::uint32_t compileLib = reportTaskIndex(graph, cache.buildTask(cache.source("mysource.cpp")));
+        const std::uint32_t linkExe = reportTaskIndex(graph, cache.buildTask(findReportProject(cache, "abuild_build_report_test")));
+
+        expect(report.criticalPath()).toBe(std::vector<std::uint32_t>{compileMain, linkExe});
+        expect(report.criticalPathDuration().count()).toBe(5200);
+        expect(report.totalWork().count()).toBe(5400);
+        expect(report.estimatedTasks()).toBe(0u);
+        expect(report.remainingDuration(compileLib).count()).toBe(400);
+        expect(report.parallelism() > 1.0).toBe(true);
+    });
+
+    test("estimated durations", [] {
+        TestProjectWithContent testProject{"abuild_build_report_test",
+                                           {{"main.cpp", "#include <myheader.hpp>"},
+                                            {"mylib/mysource.cpp", ""},
+                                            {"mylib/myheader.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        cache.setTaskDuration(*cache.buildTask(cache.source("main.cpp")), std::chrono::milliseconds{300});
+        cache.setTaskDuration(*cache.buildTask(findReportProject(cache, "abuild_build_report_test")), std::chrono::milliseconds{100});
+
+        const abuild::CompactBuildGraph graph{cache};
+        const abuild::BuildReport report{cache, graph};
+
+        const std::uint32_t compileLib = reportTaskIndex(graph, cache.buildTask(cache.source("mysource.cpp")));
+        const std::uint32_t linkLib = reportTaskIndex(graph, cache.buildTask(findReportProject(cache, "mylib")));
+
+        expect(report.estimatedTasks()).toBe(2u);
+        expect(report.estimated(compileLib)).toBe(true);
+        expect(report.duration(compileLib).count()).toBe(300);
+        expect(report.duration(linkLib).count()).toBe(200);
+        expect(report.criticalPathDuration().count()).toBe(600);
+        expect(report.criticalPath()[0]).toBe(compileLib);
+    });
+
+    test("projects", [] {
+        TestProjectWithContent testProject{"abuild_build_report_test",
+                                           {{"main.cpp", "#include <myheader.hpp>"},
+                                            {"mylib/mysource.cpp", ""},
+                                            {"mylib/myheader.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        cache.setTaskDuration(*cache.buildTask(cache.source("main.cpp")), std::chrono::milliseconds{100});
+        cache.setTaskDuration(*cache.buildTask(cache.source("mysource.cpp")), std::chrono::milliseconds{2000});
+        cache.setTaskDuration(*cache.buildTask(findReportProject(cache, "mylib")), std::chrono::milliseconds{500});
+        cache.setTaskDuration(*cache.buildTask(findReportProject(cache, "abuild_build_report_test")), std::chrono::milliseconds{200});
+
+        const abuild::CompactBuildGraph graph{cache};
+        const abuild::BuildReport report{cache, graph};
+
+        assert_(report.projects().size()).toBe(2u);
+        expect(report.projects()[0].name).toBe("mylib");
+        expect(report.projects()[0].tasks).toBe(2u);
+        expect(report.projects()[0].work.count()).toBe(2500);
+        expect(report.projects()[0].criticalPath.count()).toBe(2500);
+        expect(report.projects()[1].name).toBe("abuild_build_report_test");
+        expect(report.projects()[1].work.count()).toBe(300);
+        expect(report.projects()[1].criticalPath.count()).toBe(200);
+    });
+
+    test("json", [] {
+        TestProjectWithContent testProject{"abuild_build_report_test",
+                                           {{"main.cpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        cache.setTaskDuration(*cache.buildTask(cache.source("main.cpp")), std::chrono::milliseconds{700});
+        cache.setTaskDuration(*cache.buildTask(findReportProject(cache, "abuild_build_report_test")), std::chrono::milliseconds{300});
+
+        const abuild::CompactBuildGraph graph{cache};
+        const abuild::BuildReport report{cache, graph};
+
+        rapidjson::Document document;
+        document.Parse(report.json().c_str());
+
+        assert_(document.HasParseError()).toBe(false);
+        expect(document["criticalPathMs"].GetInt64()).toBe(1000);
+        expect(document["totalWorkMs"].GetInt64()).toBe(1000);
+        assert_(document["criticalPath"].Size()).toBe(2u);
+        expect(std::string{document["criticalPath"][0]["task"].GetString()}).toBe("compile main.cpp");
+        expect(std::string{document["criticalPath"][1]["task"].GetString()}).toBe("link executable abuild_build_report_test");
+        expect(std::string{document["projects"][0]["name"].GetString()}).toBe("abuild_build_report_test");
+        expect(report.text().find("compile main.cpp") != std::string::npos).toBe(true);
+    });
+});
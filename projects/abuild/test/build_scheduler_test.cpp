@@ -0,0 +1,151 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+[[nodiscard]] auto scheduleTaskIndex(const abuild::CompactBuildGraph &graph, const abuild::BuildTask *task) -> std::uint32_t
+{
+    for (std::uint32_t index = 0; index < graph.size(); ++index)
+    {
+        if (graph.task(index) == task)
+        {
+            return index;
+        }
+    }
+
+    return graph.size();
+}
+
+auto setScheduleDurations(abuild::BuildCache &cache) -> void
+{
+    for (abuild::BuildTask *task : cache.buildTasks())
+    {
+        cache.setTaskDuration(*task, std::chrono::milliseconds{10});
+    }
+
+    cache.setTaskDuration(*cache.buildTask(cache.source("mymodule.cpp")), std::chrono::milliseconds{100});
+    cache.setTaskDuration(*cache.buildTask(cache.source("a.cpp")), std::chrono::milliseconds{100});
+    cache.setTaskDuration(*cache.buildTask(cache.source("b.cpp")), std::chrono::milliseconds{100});
+    cache.setTaskDuration(*cache.buildTask(cache.source("c.cpp")), std::chrono::milliseconds{1000});
+}
+
+static const auto testSuite = suite("abuild::BuildSchedule", [] {
+    test("critical path", [] {
+        TestProjectWithContent testProject{"abuild_build_scheduler_test",
+                                           {{"a.cpp", "import mymodule;"},
+                                            {"b.cpp", "import mymodule;"},
+                                            {"c.cpp", ""},
+                                            {"mymodule/mymodule.cpp", "export module mymodule;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+        setScheduleDurations(cache);
+
+        const abuild::CompactBuildGraph graph{cache};
+        const abuild::BuildReport report{cache, graph};
+        const abuild::BuildSchedule schedule{graph, report, abuild::SchedulingPolicy::CriticalPath};
+
+        const std::uint32_t compileInterface = scheduleTaskIndex(graph, cache.buildTask(cache.source("mymodule.cpp")));
+        const std::uint32_t compileC = scheduleTaskIndex(graph, cache.buildTask(cache.source("c.cpp")));
+
+        assert_(std::holds_alternative<abuild::CompileModuleInterfaceTask>(*graph.task(compileInterface))).toBe(true);
+        expect(schedule.priority(compileInterface)).toBe(report.remainingDuration(compileInterface).count());
+        expect(schedule.priority(compileC)).toBe(report.remainingDuration(compileC).count());
+        expect(schedule.priority(compileC) > schedule.priority(compileInterface)).toBe(true);
+    });
+
+    test("modules first", [] {
+        TestProjectWithContent testProject{"abuild_build_scheduler_test",
+                                           {{"a.cpp", "import mymodule;"},
+                                            {"b.cpp", "import mymodule;"},
+                                            {"c.cpp", ""},
+                                            {"mymodule/mymodule.cpp", "export module mymodule;"},
+                                            {"myothermodule/myothermodule.cpp", "export module myothermodule;"},
+                                            {"d.cpp", "import myothermodule;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+        setScheduleDurations(cache);
+
+        const abuild::CompactBuildGraph graph{cache};
+        const abuild::BuildReport report{cache, graph};
+        const abuild::BuildSchedule schedule{graph, report, abuild::SchedulingPolicy::ModulesFirst};
+
+        const std::uint32_t compileInterface = scheduleTaskIndex(graph, cache.buildTask(cache.source("mymodule.cpp")));
+        const std::uint32_t compileOtherInterface = scheduleTaskIndex(graph, cache.buildTask(cache.source("myothermodule.cpp")));
+        const std::uint32_t compileC = scheduleTaskIndex(graph, cache.buildTask(cache.source("c.cpp")));
+
+        assert_(graph.dependents(compileInterface).size() > graph.dependents(compileOtherInterface).size()).toBe(true);
+        expect(schedule.priority(compileInterface) > schedule.priority(compileC)).toBe(true);
+        expect(schedule.priority(compileOtherInterface) > schedule.priority(compileC)).toBe(true);
+        expect(schedule.priority(compileInterface) > schedule.priority(compileOtherInterface)).toBe(true);
+    });
+
+    test("simulation on a single thread", [] {
+        TestProjectWithContent testProject{"abuild_build_scheduler_test",
+                                           {{"a.cpp", "import mymodule;"},
+                                            {"b.cpp", "import mymodule;"},
+                                            {"c.cpp", ""},
+                                            {"mymodule/mymodule.cpp", "export module mymodule;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+        setScheduleDurations(cache);
+
+        const abuild::CompactBuildGraph graph{cache};
+        const abuild::BuildReport report{cache, graph};
+        const abuild::BuildSimulation criticalPath{graph, report, abuild::BuildSchedule{graph, report, abuild::SchedulingPolicy::CriticalPath}, 1};
+        const abuild::BuildSimulation modulesFirst{graph, report, abuild::BuildSchedule{graph, report, abuild::SchedulingPolicy::ModulesFirst}, 1};
+
+        const std::uint32_t compileInterface = scheduleTaskIndex(graph, cache.buildTask(cache.source("mymodule.cpp")));
+        const std::uint32_t compileA = scheduleTaskIndex(graph, cache.buildTask(cache.source("a.cpp")));
+
+        expect(criticalPath.duration()).toBe(report.totalWork());
+        expect(modulesFirst.duration()).toBe(report.totalWork());
+        expect(criticalPath.utilization()).toBe(1.0);
+        expect(modulesFirst.start(compileInterface).count()).toBe(0);
+        expect(modulesFirst.ready(compileA).count()).toBe(100);
+        expect(criticalPath.ready(compileA).count()).toBe(1100);
+        expect(modulesFirst.meanReadyTime<abuild::CompileSourceTask>() < criticalPath.meanReadyTime<abuild::CompileSourceTask>()).toBe(true);
+    });
+
+    test("simulation without contention", [] {
+        TestProjectWithContent testProject{"abuild_build_scheduler_test",
+                                           {{"a.cpp", "import mymodule;"},
+                                            {"b.cpp", "import mymodule;"},
+                                            {"c.cpp", ""},
+                                            {"mymodule/mymodule.cpp", "export module mymodule;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+        setScheduleDurations(cache);
+
+        const abuild::CompactBuildGraph graph{cache};
+        const abuild::BuildReport report{cache, graph};
+        const abuild::BuildSimulation simulation{graph, report, abuild::BuildSchedule{graph, report, abuild::SchedulingPolicy::ModulesFirst}, graph.size()};
+
+        expect(simulation.duration()).toBe(report.criticalPathDuration());
+
+        for (std::uint32_t task = 0; task < graph.size(); ++task)
+        {
+            expect(simulation.start(task)).toBe(simulation.ready(task));
+            expect(simulation.finish(task)).toBe(simulation.start(task) + report.duration(task));
+        }
+    });
+});
@@ -0,0 +1,147 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+static constexpr std::chrono::milliseconds TIMEOUT{2000};
+
+static const auto testSuite = suite("abuild::CacheWatcher", [] {
+    test("initial scan", [] {
+        TestProjectWithContent testProject{"abuild_cache_watcher_test",
+                                           {{"main.cpp", "#include \"header.hpp\""},
+                                            {"header.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::CacheWatcher watcher{cache};
+
+        expect(watcher.fullScans()).toBe(1u);
+        expect(cache.sources().size()).toBe(1u);
+        expect(cache.headers().size()).toBe(1u);
+        expect(watcher.update(std::chrono::milliseconds{10})).toBe(false);
+    });
+
+    test("modified source", [] {
+        TestProjectWithContent testProject{"abuild_cache_watcher_test",
+                                           {{"main.cpp", "#include \"header.hpp\""},
+                                            {"header.hpp", ""},
+                                            {"other.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::CacheWatcher watcher{cache};
+
+        std::ofstream{testProject.projectRoot() / "main.cpp"} << "#include \"other.hpp\"";
+
+        assert_(watcher.update(TIMEOUT)).toBe(true);
+        expect(watcher.fullScans()).toBe(1u);
+        expect(watcher.modifiedFiles()).toBe(1u);
+
+        abuild::Source *source = cache.source("main.cpp");
+
+        assert_(source->dependencies().size()).toBe(1u);
+        expect(std::get<abuild::IncludeLocalHeaderDependency>(source->dependencies()[0]).header).toBe(cache.header("other.hpp"));
+    });
+
+    test("added source", [] {
+        TestProjectWithContent testProject{"abuild_cache_watcher_test",
+                                           {{"main.cpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::CacheWatcher watcher{cache};
+
+        std::ofstream{testProject.projectRoot() / "source.cpp"};
+
+        assert_(watcher.update(TIMEOUT)).toBe(true);
+        expect(watcher.fullScans()).toBe(1u);
+        expect(watcher.addedFiles()).toBe(1u);
+        expect(cache.sources().size()).toBe(2u);
+        expect(cache.source("source.cpp")).toBe(cache.sources()[1]);
+    });
+
+    test("added header resolves missing include", [] {
+        TestProjectWithContent testProject{"abuild_cache_watcher_test",
+                                           {{"main.cpp", "#include \"include/header.hpp\""},
+                                            {"include/other.hpp", "#include \"header.hpp\""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::CacheWatcher watcher{cache};
+
+        assert_(cache.warnings().size()).toBe(2u);
+
+        std::ofstream{testProject.projectRoot() / "include" / "header.hpp"} << "#include <vector>";
+
+        assert_(watcher.update(TIMEOUT)).toBe(true);
+        expect(watcher.fullScans()).toBe(1u);
+        expect(watcher.addedFiles()).toBe(1u);
+        assert_(cache.headers().size()).toBe(2u);
+
+        abuild::Header *header = cache.header("include/header.hpp");
+
+        assert_(header != nullptr).toBe(true);
+        expect(header->dependencies().size()).toBe(1u);
+        expect(std::get<abuild::IncludeLocalHeaderDependency>(cache.source("main.cpp")->dependencies()[0]).header).toBe(header);
+        expect(std::get<abuild::IncludeLocalHeaderDependency>(cache.header("other.hpp")->dependencies()[0]).header).toBe(header);
+        expect(cache.warnings().size()).toBe(0u);
+    });
+
+    test("added source in new project", [] {
+        TestProjectWithContent testProject{"abuild_cache_watcher_test",
+                                           {{"main.cpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::CacheWatcher watcher{cache};
+
+        std::filesystem::create_directory(testProject.projectRoot() / "mylib");
+        std::ofstream{testProject.projectRoot() / "mylib" / "mylib.cpp"};
+
+        assert_(watcher.update(TIMEOUT)).toBe(true);
+        expect(watcher.fullScans()).toBe(2u);
+        expect(cache.sources().size()).toBe(2u);
+    });
+
+    test("removed header", [] {
+        TestProjectWithContent testProject{"abuild_cache_watcher_test",
+                                           {{"main.cpp", "#include \"include/header.hpp\""},
+                                            {"include/header.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::CacheWatcher watcher{cache};
+
+        std::filesystem::remove(testProject.projectRoot() / "include" / "header.hpp");
+
+        assert_(watcher.update(TIMEOUT)).toBe(true);
+        expect(watcher.fullScans()).toBe(2u);
+        expect(cache.headers().size()).toBe(0u);
+    });
+
+    test("ignored directory", [] {
+        TestProjectWithContent testProject{"abuild_cache_watcher_test",
+                                           {{"main.cpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::CacheWatcher watcher{cache};
+
+        std::filesystem::create_directory(testProject.projectRoot() / "build");
+
+        assert_(watcher.update(TIMEOUT)).toBe(true);
+        expect(watcher.fullScans()).toBe(1u);
+    });
+
+    test("directory attribute change", [] {
+        TestProjectWithContent testProject{"abuild_cache_watcher_test",
+                                           {{"main.cpp", "#include \"include/header.hpp\""},
+                                            {"include/header.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::CacheWatcher watcher{cache};
+
+        std::filesystem::permissions(testProject.projectRoot() / "include", std::filesystem::perms::owner_all);
+        std::filesystem::last_write_time(testProject.projectRoot() / "include", std::filesystem::file_time_type::clock::now());
+
+        expect(watcher.update(std::chrono::milliseconds{100})).toBe(false);
+        expect(watcher.fullScans()).toBe(1u);
+    });
+});
@@ -112,4 +112,44 @@ static const auto testSuite = suite("abuild::CodeScanner (modules)", [] {
         expect(cache.warnings()[0].component).toBe("CodeScanner");
         expect(cache.warnings()[0].what).toBe("Declaring module partitions in headers is unsupported. Ignoring. (" + (testProject.projectRoot() / "header.hpp").string() + ')');
     });
+
+    test("parallel scan is deterministic", [] {
+        std::vector<std::pair<std::filesystem::path, std::string>> files;
+
+        for (int i = 0; i < 20; ++i)
+        {
+            const std::string index = std::to_string(i);
+            files.push_back({"mymodule" + index + ".cpp", "export module mymodule" + index + ";"});
+            files.push_back({"mymodule" + index + "_partition.cpp", "module mymodule" + index + " : mypartition;"});
+            files.push_back({"header" + index + ".hpp", "export module mymodule" + index + ";"});
+        }
+
+        TestProjectWithContent testProject{"abuild_code_scanner_test", files};
+
+        abuild::BuildCache serialCache{testProject.projectRoot()};
+        abuild::ProjectScanner{serialCache};
+        abuild::CodeScanner{serialCache, 1};
+
+        abuild::BuildCache parallelCache{testProject.projectRoot()};
+        abuild::ProjectScanner{parallelCache};
+        abuild::CodeScanner{parallelCache, 8};
+
+        assert_(parallelCache.modules().size()).toBe(20u);
+        assert_(serialCache.modules().size()).toBe(20u);
+        assert_(parallelCache.warnings().size()).toBe(20u);
+        assert_(serialCache.warnings().size()).toBe(20u);
+
+        for (std::size_t i = 0; i < parallelCache.modules().size(); ++i)
+        {
+            expect(parallelCache.modules()[i]->name).toBe(serialCache.modules()[i]->name);
+            expect(parallelCache.modules()[i]->source->path()).toBe(serialCache.modules()[i]->source->path());
+            assert_(parallelCache.modules()[i]->partitions.size()).toBe(1u);
+            expect(parallelCache.modules()[i]->partitions[0]->source->path()).toBe(serialCache.modules()[i]->partitions[0]->source->path());
+        }
+
+        for (std::size_t i = 0; i < parallelCache.warnings().size(); ++i)
+        {
+            expect(parallelCache.warnings()[i].what).toBe(serialCache.warnings()[i].what);
+        }
+    });
 });
\ No newline at end of file
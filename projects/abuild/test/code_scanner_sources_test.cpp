@@ -251,4 +251,18 @@ static const auto testSuite = suite("abuild::CodeScanner (sources)", [] {
         expect(dep2.visibility).toBe(abuild::DependencyVisibility::Public);
         expect(dep2.partition).toBe(nullptr);
     });
-});
\ No newline at end of file
+
+    test("preamble threshold", [] {
+        TestProjectWithContent testProject{"abuild_code_scanner_test",
+                                           {{".abuild", "{ \"settings\": { \"preambleThreshold\": 1 } }"},
+                                            {"main.cpp", "#include <vector>\nint main() {}\n#include <string>"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+
+        assert_(cache.sources().size()).toBe(1u);
+        assert_(cache.sources()[0]->dependencies().size()).toBe(1u);
+        expect(std::get<abuild::IncludeSTLHeaderDependency>(cache.sources()[0]->dependencies()[0]).name).toBe("vector");
+    });
+});
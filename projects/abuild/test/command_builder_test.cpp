@@ -0,0 +1,234 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+[[nodiscard]] auto clangToolchain() -> abuild::Toolchain
+{
+    return abuild::Toolchain{
+        .name = "clang",
+        .type = abuild::Toolchain::Type::Clang,
+        .compiler = "clang++",
+        .linker = "ld",
+        .archiver = "ar",
+        .compilerFlags = {"-std=c++20", "-c"}};
+}
+
+[[nodiscard]] auto msvcToolchain() -> abuild::Toolchain
+{
+    return abuild::Toolchain{
+        .name = "msvc",
+        .type = abuild::Toolchain::Type::MSVC,
+        .compiler = "cl.exe",
+        .linker = "link.exe",
+        .archiver = "lib.exe",
+        .compilerFlags = {"/std:c++latest", "/c"}};
+}
+
+[[nodiscard]] auto gccToolchain() -> abuild::Toolchain
+{
+    return abuild::Toolchain{
+        .name = "gcc",
+        .type = abuild::Toolchain::Type::GCC,
+        .compiler = "/usr/bin/g++",
+        .linker = "/usr/bin/g++",
+        .archiver = "/usr/bin/ar",
+        .compilerFlags = {"-std=c++20", "-fmodules-ts", "-c", "-x c++"}};
+}
+
+[[nodiscard]] auto executableName(const std::string &name) -> std::string
+{
+#ifdef _WIN32
+    return name + ".exe";
+#else
+    return name;
+#endif
+}
+
+static const auto testSuite = suite("abuild::CommandBuilder", [] {
+    test("build root", [] {
+        TestProjectWithContent testProject{"abuild_command_builder_test",
+                                           {{".abuild", "{ \"settings\": { \"buildDirectory\": \"out\" } }"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        const abuild::Toolchain toolchain = clangToolchain();
+
+        expect(abuild::CommandBuilder{cache, toolchain}.buildRoot()).toBe(testProject.projectRoot() / "out" / "clang");
+    });
+
+    test("compile source (clang)", [] {
+        TestProjectWithContent testProject{"abuild_command_builder_test",
+                                           {{"main.cpp", "int main() {}"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::Toolchain toolchain = clangToolchain();
+        const abuild::CommandBuilder builder{cache, toolchain};
+        const std::filesystem::path buildRoot = testProject.projectRoot() / "build" / "clang";
+        const abuild::BuildTask *task = cache.buildTask(cache.sources()[0]);
+
+        assert_(task != nullptr).toBe(true);
+
+        const std::vector<abuild::Command> commands = builder.commands(*task);
+
+        assert_(commands.size()).toBe(1u);
+        expect(commands[0].executable).toBe(std::filesystem::path{"clang++"});
+        expect(commands[0].arguments)
+            .toBe(std::vector<std::string>{
+                "-c",
+                "-std=c++20",
+                "-fprebuilt-module-path=" + (buildRoot / "modules").string(),
+                (testProject.projectRoot() / "main.cpp").string(),
+                "-o",
+                (buildRoot / "obj" / "main.cpp.o").string()});
+        expect(builder.outputs(*task)).toBe(std::vector<std::filesystem::path>{buildRoot / "obj" / "main.cpp.o"});
+    });
+
+    test("link executable (clang)", [] {
+        TestProjectWithContent testProject{"abuild_command_builder_test",
+                                           {{"main.cpp", "int main() {}"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::Toolchain toolchain = clangToolchain();
+        const abuild::CommandBuilder builder{cache, toolchain};
+        const std::filesystem::path buildRoot = testProject.projectRoot() / "build" / "clang";
+        const abuild::BuildTask *task = cache.buildTask(cache.projects()[0]);
+
+        assert_(task != nullptr).toBe(true);
+
+        const std::vector<abuild::Command> commands = builder.commands(*task);
+        const std::filesystem::path executable = buildRoot / "bin" / executableName("abuild_command_builder_test");
+
+        assert_(commands.size()).toBe(1u);
+        expect(commands[0].executable).toBe(std::filesystem::path{"clang++"});
+        expect(commands[0].arguments)
+            .toBe(std::vector<std::string>{
+                (buildRoot / "obj" / "main.cpp.o").string(),
+                "-o",
+                executable.string()});
+        expect(builder.outputs(*task)).toBe(std::vector<std::filesystem::path>{executable});
+    });
+
+    test("compile source (msvc)", [] {
+        TestProjectWithContent testProject{"abuild_command_builder_test",
+                                           {{"main.cpp", "int main() {}"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::Toolchain toolchain = msvcToolchain();
+        const abuild::CommandBuilder builder{cache, toolchain};
+        const std::filesystem::path buildRoot = testProject.projectRoot() / "build" / "msvc";
+        const abuild::BuildTask *task = cache.buildTask(cache.sources()[0]);
+
+        assert_(task != nullptr).toBe(true);
+
+        const std::vector<abuild::Command> commands = builder.commands(*task);
+
+        assert_(commands.size()).toBe(1u);
+        expect(commands[0].executable).toBe(std::filesystem::path{"cl.exe"});
+        expect(commands[0].arguments)
+            .toBe(std::vector<std::string>{
+                "/c",
+                "/std:c++latest",
+                "/ifcSearchDir",
+                (buildRoot / "modules").string(),
+                "/Fo" + (buildRoot / "obj" / "main.cpp.obj").string(),
+                (testProject.projectRoot() / "main.cpp").string()});
+    });
+
+    test("module interface (clang)", [] {
+        TestProjectWithContent testProject{"abuild_command_builder_test",
+                                           {{"mymodule.cpp", "export module mymodule;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::Toolchain toolchain = clangToolchain();
+        const abuild::CommandBuilder builder{cache, toolchain};
+        const std::filesystem::path buildRoot = testProject.projectRoot() / "build" / "clang";
+        const abuild::BuildTask *task = cache.buildTask(cache.sources()[0]);
+
+        assert_(task != nullptr).toBe(true);
+
+        const std::vector<abuild::Command> commands = builder.commands(*task);
+
+        assert_(commands.size()).toBe(2u);
+        expect(commands[0].arguments.back()).toBe((buildRoot / "modules" / "mymodule.pcm").string());
+        expect(commands[1].arguments.back()).toBe((buildRoot / "obj" / "mymodule.cpp.o").string());
+        expect(builder.outputs(*task))
+            .toBe(std::vector<std::filesystem::path>{
+                buildRoot / "modules" / "mymodule.pcm",
+                buildRoot / "obj" / "mymodule.cpp.o"});
+    });
+
+#ifndef _WIN32
+    test("module mapper (gcc)", [] {
+        const abuild::Toolchain toolchain = gccToolchain();
+
+        if (!std::filesystem::exists(toolchain.compiler))
+        {
+            return;
+        }
+
+        TestProjectWithContent testProject{"abuild_command_builder_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"\" } }"},
+                                            {"header.hpp", "inline int header() { return 1; }"},
+                                            {"mymodule.cpp", "export module mymodule;\nexport import :part;"},
+                                            {"part.cpp", "export module mymodule:part;\nexport int part() { return 2; }"},
+                                            {"user.cpp", "import mymodule;\nimport \"header.hpp\";\nint user() { return header() + part(); }"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::CommandBuilder builder{cache, toolchain};
+
+        {
+            const abuild::BuildExecutor executor{cache, toolchain};
+
+            assert_(cache.errors().size()).toBe(0u);
+            expect(executor.executedTasks()).toBe(cache.buildTasks().size());
+        }
+
+        std::size_t bmis = 0;
+
+        for (const abuild::BuildTask *task : cache.buildTasks())
+        {
+            if (const std::optional<std::filesystem::path> bmi = builder.bmi(*task))
+            {
+                bmis++;
+                expect(std::filesystem::is_regular_file(*bmi)).toBe(true);
+            }
+        }
+
+        expect(bmis).toBe(3u);
+        expect(std::filesystem::exists(builder.buildRoot() / "gcm.cache")).toBe(false);
+
+        const abuild::BuildExecutor executor{cache, toolchain};
+
+        expect(executor.upToDateTasks()).toBe(cache.buildTasks().size());
+    });
+#endif
+});
@@ -0,0 +1,150 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+[[nodiscard]] auto taskIndex(const abuild::CompactBuildGraph &graph, const abuild::BuildTask *task) -> std::uint32_t
+{
+    for (std::uint32_t index = 0; index < graph.size(); ++index)
+    {
+        if (graph.task(index) == task)
+        {
+            return index;
+        }
+    }
+
+    return graph.size();
+}
+
+[[nodiscard]] auto findProjectByName(const abuild::BuildCache &cache, const std::string &name) -> const abuild::Project *
+{
+    for (abuild::Project *project : cache.projects())
+    {
+        if (project->name() == name)
+        {
+            return project;
+        }
+    }
+
+    return nullptr;
+}
+
+[[nodiscard]] auto toVector(std::span<const std::uint32_t> values) -> std::vector<std::uint32_t>
+{
+    return std::vector<std::uint32_t>{values.begin(), values.end()};
+}
+
+static const auto testSuite = suite("abuild::CompactBuildGraph", [] {
+    test("empty", [] {
+        TestProjectWithContent testProject{"abuild_compact_build_graph_test",
+                                           {{"header.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::CompactBuildGraph graph{cache};
+
+        expect(graph.size()).toBe(0u);
+        expect(graph.tasks<abuild::CompileSourceTask>().size()).toBe(0u);
+    });
+
+    test("tasks grouped by kind", [] {
+        TestProjectWithContent testProject{"abuild_compact_build_graph_test",
+                                           {{"main.cpp", "#include <myheader.hpp>"},
+                                            {"other.cpp", ""},
+                                            {"mylib/mysource.cpp", ""},
+                                            {"mylib/myheader.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::CompactBuildGraph graph{cache};
+
+        assert_(graph.size()).toBe(cache.buildTasks().size());
+
+        std::span<abuild::BuildTask *const> compileTasks = graph.tasks<abuild::CompileSourceTask>();
+        std::span<abuild::BuildTask *const> executableTasks = graph.tasks<abuild::LinkExecutableTask>();
+        std::span<abuild::BuildTask *const> libraryTasks = graph.tasks<abuild::LinkLibraryTask>();
+
+        assert_(compileTasks.size()).toBe(3u);
+        assert_(executableTasks.size()).toBe(1u);
+        assert_(libraryTasks.size()).toBe(1u);
+        expect(graph.tasks<abuild::CompileHeaderUnitTask>().size()).toBe(0u);
+
+        for (abuild::BuildTask *task : compileTasks)
+        {
+            expect(std::holds_alternative<abuild::CompileSourceTask>(*task)).toBe(true);
+        }
+
+        expect(compileTasks.data() + compileTasks.size() <= executableTasks.data()).toBe(true);
+    });
+
+    test("inputs and dependents", [] {
+        TestProjectWithContent testProject{"abuild_compact_build_graph_test",
+                                           {{"main.cpp", "#include <myheader.hpp>"},
+                                            {"mylib/mysource.cpp", ""},
+                                            {"mylib/myheader.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::CompactBuildGraph graph{cache};
+
+        const std::uint32_t compileMain = taskIndex(graph, cache.buildTask(cache.source("main.cpp")));
+        const std::uint32_t compileLib = taskIndex(graph, cache.buildTask(cache.source("mysource.cpp")));
+        const std::uint32_t linkExe = taskIndex(graph, cache.buildTask(findProjectByName(cache, "abuild_compact_build_graph_test")));
+        const std::uint32_t linkLib = taskIndex(graph, cache.buildTask(findProjectByName(cache, "mylib")));
+
+        assert_(graph.size()).toBe(4u);
+        assert_(compileMain < graph.size()).toBe(true);
+        assert_(compileLib < graph.size()).toBe(true);
+        assert_(linkExe < graph.size()).toBe(true);
+        assert_(linkLib < graph.size()).toBe(true);
+
+        std::vector<std::uint32_t> exeInputs{compileMain, linkLib};
+        std::sort(exeInputs.begin(), exeInputs.end());
+
+        expect(toVector(graph.inputs(linkExe))).toBe(exeInputs);
+        expect(toVector(graph.inputs(linkLib))).toBe(std::vector<std::uint32_t>{compileLib});
+        expect(toVector(graph.inputs(compileMain))).toBe(std::vector<std::uint32_t>{});
+        expect(toVector(graph.dependents(compileMain))).toBe(std::vector<std::uint32_t>{linkExe});
+        expect(toVector(graph.dependents(linkLib))).toBe(std::vector<std::uint32_t>{linkExe});
+        expect(toVector(graph.dependents(linkExe))).toBe(std::vector<std::uint32_t>{});
+    });
+
+    test("include paths", [] {
+        TestProjectWithContent testProject{"abuild_compact_build_graph_test",
+                                           {{"main.cpp", "#include <myheader.hpp>"},
+                                            {"other.cpp", "#include <myheader.hpp>"},
+                                            {"mylib/myheader.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::CompactBuildGraph graph{cache};
+
+        const std::uint32_t compileMain = taskIndex(graph, cache.buildTask(cache.source("main.cpp")));
+        const std::uint32_t compileOther = taskIndex(graph, cache.buildTask(cache.source("other.cpp")));
+
+        assert_(graph.includePaths(compileMain).size()).toBe(1u);
+        assert_(graph.includePaths(compileOther).size()).toBe(1u);
+        expect(graph.includePaths(compileMain)[0]).toBe(graph.includePaths(compileOther)[0]);
+        expect(graph.includePath(graph.includePaths(compileMain)[0])).toBe(testProject.projectRoot() / "mylib");
+    });
+});
@@ -22,7 +22,7 @@ static const auto testSuite = suite("abuild::DependencyScanner", [] {
         assert_(cache.headers().size()).toBe(1u);
         assert_(cache.sources()[0]->dependencies().size()).toBe(1u);
 
-        expect(std::get<abuild::IncludeLocalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0].get());
+        expect(std::get<abuild::IncludeLocalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0]);
     });
 
     test("local header under subdir", [] {
@@ -39,7 +39,7 @@ static const auto testSuite = suite("abuild::DependencyScanner", [] {
         assert_(cache.headers().size()).toBe(1u);
         assert_(cache.sources()[0]->dependencies().size()).toBe(1u);
 
-        expect(std::get<abuild::IncludeLocalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0].get());
+        expect(std::get<abuild::IncludeLocalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0]);
     });
 
     test("local header not found locally", [] {
@@ -56,7 +56,7 @@ static const auto testSuite = suite("abuild::DependencyScanner", [] {
         assert_(cache.headers().size()).toBe(1u);
         assert_(cache.sources()[0]->dependencies().size()).toBe(1u);
 
-        expect(std::get<abuild::IncludeLocalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0].get());
+        expect(std::get<abuild::IncludeLocalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0]);
     });
 
     test("local header found locally with other candidates", [] {
@@ -107,7 +107,7 @@ static const auto testSuite = suite("abuild::DependencyScanner", [] {
         assert_(cache.headers().size()).toBe(1u);
         assert_(cache.sources()[0]->dependencies().size()).toBe(1u);
 
-        expect(std::get<abuild::IncludeExternalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0].get());
+        expect(std::get<abuild::IncludeExternalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0]);
     });
 
     test("local source", [] {
@@ -158,7 +158,7 @@ static const auto testSuite = suite("abuild::DependencyScanner", [] {
         assert_(cache.headers().size()).toBe(1u);
         assert_(cache.sources()[0]->dependencies().size()).toBe(1u);
 
-        expect(std::get<abuild::ImportLocalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0].get());
+        expect(std::get<abuild::ImportLocalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0]);
     });
 
     test("import external header", [] {
@@ -175,7 +175,7 @@ static const auto testSuite = suite("abuild::DependencyScanner", [] {
         assert_(cache.headers().size()).toBe(1u);
         assert_(cache.sources()[0]->dependencies().size()).toBe(1u);
 
-        expect(std::get<abuild::ImportExternalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0].get());
+        expect(std::get<abuild::ImportExternalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0]);
     });
 
     test("import module", [] {
@@ -192,7 +192,7 @@ static const auto testSuite = suite("abuild::DependencyScanner", [] {
         assert_(cache.source("main.cpp") != nullptr).toBe(true);
         assert_(cache.source("main.cpp")->dependencies().size()).toBe(1u);
 
-        expect(std::get<abuild::ImportModuleDependency>(cache.source("main.cpp")->dependencies()[0]).mod).toBe(cache.modules()[0].get());
+        expect(std::get<abuild::ImportModuleDependency>(cache.source("main.cpp")->dependencies()[0]).mod).toBe(cache.modules()[0]);
     });
 
     test("import module partition", [] {
@@ -338,6 +338,6 @@ static const auto testSuite = suite("abuild::DependencyScanner", [] {
         assert_(cache.headers().size()).toBe(1u);
         assert_(cache.sources()[0]->dependencies().size()).toBe(1u);
 
-        expect(std::get<abuild::IncludeLocalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0].get());
+        expect(std::get<abuild::IncludeLocalHeaderDependency>(cache.sources()[0]->dependencies()[0]).header).toBe(cache.headers()[0]);
     });
 });
@@ -69,31 +69,41 @@ static const auto testSuite = suite("abuild::File", [] {
                                 {"main.cpp"}};
 
         const std::filesystem::path path = testProject.projectRoot() / "main.cpp";
-        auto getTimestamp = [&]() { return std::chrono::duration_cast<std::chrono::seconds>(std::filesystem::last_write_time(path).time_since_epoch()).count(); };
-        const std::int64_t lastModified = getTimestamp();
 
         abuild::Project project{"myproject"};
         const abuild::File file{testProject.projectRoot() / "main.cpp", &project};
+        const std::int64_t lastModified = file.timestamp();
 
-        expect(file.timestamp()).toBe(lastModified);
+        expect(lastModified != 0).toBe(true);
 
         std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + 1h);
 
         expect(file.timestamp()).toBe(lastModified);
     });
 
+    test("status", [] {
+        TestProjectWithContent testProject{"build_test_file",
+                                           {{"main.cpp", "int main() {}"}}};
+
+        abuild::Project project{"myproject"};
+        const abuild::File file{testProject.projectRoot() / "main.cpp", &project};
+
+        expect(file.status().timestamp).toBe(file.timestamp());
+        expect(file.status().size).toBe(13u);
+    });
+
     test("custom timestamp", [] {
         using namespace std::chrono_literals;
 
         TestProject testProject{"build_test_file",
                                 {"main.cpp"}};
 
-        const std::filesystem::path path = testProject.projectRoot() / "main.cpp";
-        const std::int64_t timestamp = std::chrono::duration_cast<std::chrono::seconds>((std::filesystem::last_write_time(path) - 1h).time_since_epoch()).count();
+        const std::int64_t timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(1h).count();
         abuild::Project project{"myproject"};
-        const abuild::File file{testProject.projectRoot() / "main.cpp", &project, timestamp};
+        const abuild::File file{testProject.projectRoot() / "main.cpp", &project, abuild::FileStatus{.timestamp = timestamp}};
 
         expect(file.timestamp()).toBe(timestamp);
+        expect(file.isModified()).toBe(true);
     });
 
     test("isModified", [] {
@@ -114,6 +124,40 @@ static const auto testSuite = suite("abuild::File", [] {
         expect(file.isModified()).toBe(true);
     });
 
+    test("isModified within a second", [] {
+        using namespace std::chrono_literals;
+
+        TestProject testProject{"build_test_file",
+                                {"main.cpp"}};
+
+        const std::filesystem::path path = testProject.projectRoot() / "main.cpp";
+
+        abuild::Project project{"myproject"};
+        const abuild::File file{testProject.projectRoot() / "main.cpp", &project};
+
+        std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + 1ms);
+
+        expect(file.isModified()).toBe(true);
+    });
+
+    test("isModified size", [] {
+        using namespace std::chrono_literals;
+
+        TestProjectWithContent testProject{"build_test_file",
+                                           {{"main.cpp", "int main() {}"}}};
+
+        const std::filesystem::path path = testProject.projectRoot() / "main.cpp";
+
+        abuild::Project project{"myproject"};
+        const abuild::File file{testProject.projectRoot() / "main.cpp", &project};
+        const std::filesystem::file_time_type timestamp = std::filesystem::last_write_time(path);
+
+        std::ofstream{path} << "int main() { return 0; }";
+        std::filesystem::last_write_time(path, timestamp);
+
+        expect(file.isModified()).toBe(true);
+    });
+
     test("update", [] {
         using namespace std::chrono_literals;
 
@@ -0,0 +1,67 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+static const auto testSuite = suite("abuild::FileView", [] {
+    test("type traits", [] {
+        expect(std::is_default_constructible_v<abuild::FileView>).toBe(false);
+        expect(std::is_copy_constructible_v<abuild::FileView>).toBe(false);
+        expect(std::is_copy_assignable_v<abuild::FileView>).toBe(false);
+        expect(std::is_nothrow_destructible_v<abuild::FileView>).toBe(true);
+    });
+
+    test("missing file", [] {
+        expect([] { abuild::FileView{"missing_file"}; }).toThrow<std::runtime_error>("Failed to open file 'missing_file'.");
+    });
+
+    test("empty file", [] {
+        TestProject testProject{"build_test_file_view",
+                                {"main.cpp"}};
+
+        const abuild::FileView view{testProject.projectRoot() / "main.cpp"};
+
+        expect(view.content().empty()).toBe(true);
+    });
+
+    test("small file", [] {
+        TestProjectWithContent testProject{"build_test_file_view",
+                                           {{"main.cpp", "auto main(int argc, char *argv[])\n{\n    return 0;\n}\n"}}};
+
+        const abuild::FileView view{testProject.projectRoot() / "main.cpp"};
+
+        expect(std::string{view.content()}).toBe("auto main(int argc, char *argv[])\n{\n    return 0;\n}\n");
+    });
+
+    test("large file", [] {
+        std::string content;
+
+        for (int i = 0; content.size() < 1024 * 1024; ++i)
+        {
+            content += "#include \"header" + std::to_string(i) + ".hpp\"\n";
+        }
+
+        TestProjectWithContent testProject{"build_test_file_view",
+                                           {{"main.cpp", content}}};
+
+        const abuild::FileView view{testProject.projectRoot() / "main.cpp"};
+
+        assert_(view.content().size()).toBe(content.size());
+        expect(view.content() == content).toBe(true);
+    });
+
+    test("file view", [] {
+        TestProjectWithContent testProject{"build_test_file_view",
+                                           {{"main.cpp", "import mymodule;"}}};
+
+        abuild::Project project{"myproject"};
+        const abuild::File file{testProject.projectRoot() / "main.cpp", &project};
+        const abuild::FileView view = file.view();
+
+        expect(std::string{view.content()}).toBe("import mymodule;");
+    });
+});
@@ -0,0 +1,65 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+static const auto testSuite = suite("abuild::Fingerprint", [] {
+    test("hex", [] {
+        abuild::Fingerprint fingerprint;
+        fingerprint.add("abuild");
+
+        const std::string hex = fingerprint.hex();
+
+        expect(hex.size()).toBe(32u);
+        expect(hex.find_first_not_of("0123456789abcdef")).toBe(std::string::npos);
+    });
+
+    test("blake2b", [] {
+        expect(abuild::Fingerprint{}.hex()).toBe("cae66941d9efbd404e4d88758ea67670");
+        expect(abuild::Fingerprint{}.add("abuild").hex()).toBe("21f43eddb58264fe23c7347080d0dbc7");
+        expect(abuild::Fingerprint{}.add(std::string(120, 'y')).hex()).toBe("029a7fe105bafb38547651164ba8351f");
+        expect(abuild::Fingerprint{}.add(std::string(300, 'x')).hex()).toBe("7301659ba784d86d11b971384baf0235");
+        expect(abuild::Fingerprint{}.add("clang++").add(std::uint64_t{42}).hex()).toBe("7ea22ae1d5dcc08ac435e530fb487bb8");
+    });
+
+    test("deterministic", [] {
+        abuild::Fingerprint fingerprint;
+        fingerprint.add("clang++").add(std::uint64_t{42}).add(std::filesystem::path{"include/vector"}.generic_string());
+        abuild::Fingerprint other;
+        other.add("clang++").add(std::uint64_t{42}).add(std::filesystem::path{"include/vector"}.generic_string());
+
+        expect(fingerprint.hex()).toBe(other.hex());
+        expect(fingerprint.value() == other.value()).toBe(true);
+    });
+
+    test("content sensitive", [] {
+        abuild::Fingerprint fingerprint;
+        fingerprint.add("-std=c++20");
+        abuild::Fingerprint other;
+        other.add("-std=c++23");
+
+        expect(fingerprint.hex() != other.hex()).toBe(true);
+    });
+
+    test("boundary sensitive", [] {
+        abuild::Fingerprint fingerprint;
+        fingerprint.add("ab").add("c");
+        abuild::Fingerprint other;
+        other.add("a").add("bc");
+
+        expect(fingerprint.hex() != other.hex()).toBe(true);
+    });
+
+    test("order sensitive", [] {
+        abuild::Fingerprint fingerprint;
+        fingerprint.add(std::uint64_t{1}).add(std::uint64_t{2});
+        abuild::Fingerprint other;
+        other.add(std::uint64_t{2}).add(std::uint64_t{1});
+
+        expect(fingerprint.hex() != other.hex()).toBe(true);
+    });
+});
@@ -119,6 +119,28 @@ static const auto testSuite = suite("abuild::Header", [] {
         expect(cache.header("build/header.hpp")).toBe(nullptr);
     });
 
+    test("lookup header by suffix among many with the same name", [] {
+        TestProject testProject{"build_test_project_scanner",
+                                {"a/include/types.hpp",
+                                 "b/include/types.hpp",
+                                 "b/src/types.hpp",
+                                 "c/include/detail/types.hpp"}};
+
+        abuild::BuildCache cache;
+        cache.addHeader(testProject.projectRoot() / "a" / "include" / "types.hpp", "a");
+        cache.addHeader(testProject.projectRoot() / "b" / "include" / "types.hpp", "b");
+        cache.addHeader(testProject.projectRoot() / "b" / "src" / "types.hpp", "b");
+        cache.addHeader(testProject.projectRoot() / "c" / "include" / "detail" / "types.hpp", "c");
+
+        expect(cache.header("types.hpp")->path()).toBe(testProject.projectRoot() / "a" / "include" / "types.hpp");
+        expect(cache.header("include/types.hpp")->path()).toBe(testProject.projectRoot() / "a" / "include" / "types.hpp");
+        expect(cache.header("b/include/types.hpp")->path()).toBe(testProject.projectRoot() / "b" / "include" / "types.hpp");
+        expect(cache.header("src/types.hpp")->path()).toBe(testProject.projectRoot() / "b" / "src" / "types.hpp");
+        expect(cache.header("include/detail/types.hpp")->path()).toBe(testProject.projectRoot() / "c" / "include" / "detail" / "types.hpp");
+        expect(cache.header("c/detail/types.hpp")).toBe(nullptr);
+        expect(cache.header("a/src/types.hpp")).toBe(nullptr);
+    });
+
     test("lookup header with hint", [] {
         TestProject testProject{"build_test_project_scanner",
                                 {"include/header.hpp",
@@ -155,6 +177,25 @@ static const auto testSuite = suite("abuild::Header", [] {
         expect(header->project()->name()).toBe("build_test_project_scanner");
     });
 
+    test("lookup header relative to includer", [] {
+        TestProject testProject{"build_test_project_scanner",
+                                {"include/header.hpp",
+                                 "projects/abuild/include/header.hpp",
+                                 "projects/abuild/main.cpp"}};
+
+        abuild::BuildCache cache;
+        cache.addHeader(testProject.projectRoot() / "include" / "header.hpp", "build_test_project_scanner");
+        cache.addHeader(testProject.projectRoot() / "projects" / "abuild" / "include" / "header.hpp", "abuild");
+        const abuild::Source *source = cache.addSource(testProject.projectRoot() / "projects" / "abuild" / "main.cpp", "abuild");
+
+        const abuild::Header *header = cache.header("include/header.hpp", source);
+
+        assert_(header != nullptr).toBe(true);
+        expect(header->path()).toBe(testProject.projectRoot() / "projects" / "abuild" / "include" / "header.hpp");
+        expect(cache.header("./include/../include/header.hpp", source)).toBe(header);
+        expect(cache.header("../../include/header.hpp", source)).toBe(cache.header("header.hpp"));
+    });
+
     test("lookup header with ../", [] {
         TestProject testProject{"build_test_project_scanner",
                                 {"include/header.hpp",
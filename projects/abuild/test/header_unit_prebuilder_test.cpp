@@ -0,0 +1,117 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+#ifndef _WIN32
+[[nodiscard]] auto scriptToolchain(const std::filesystem::path &script) -> abuild::Toolchain
+{
+    return abuild::Toolchain{
+        .name = "test",
+        .type = abuild::Toolchain::Type::Clang,
+        .compiler = script,
+        .linker = script,
+        .archiver = script};
+}
+
+[[nodiscard]] auto countInvocations(const std::filesystem::path &log) -> std::size_t
+{
+    std::ifstream file{log};
+    return static_cast<std::size_t>(std::count(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}, '\n'));
+}
+
+static const auto testSuite = suite("abuild::HeaderUnitPrebuilder", [] {
+    test("compiles STL header units during code scan", [] {
+        TestProjectWithContent compiler{"abuild_header_unit_prebuilder_compiler",
+                                        {{"compiler.sh", "#!/bin/sh\necho \"$@\" >> \"$(dirname \"$0\")/log\"\nwhile [ $# -gt 0 ]; do\n  if [ \"$1\" = \"-o\" ]; then mkdir -p \"$(dirname \"$2\")\" && echo output > \"$2\"; fi\n  shift\ndone\n"}}};
+        std::filesystem::permissions(compiler.projectRoot() / "compiler.sh", std::filesystem::perms::owner_all);
+        const abuild::Toolchain toolchain = scriptToolchain(compiler.projectRoot() / "compiler.sh");
+        TestProjectWithContent testProject{"abuild_header_unit_prebuilder_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"\" } }"},
+                                            {"main.cpp", "#include \"header.hpp\"\nimport <vector>;\nimport <string>;"},
+                                            {"other.cpp", "import <vector>;"},
+                                            {"header.hpp", "import <map>;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+
+        {
+            abuild::HeaderUnitPrebuilder prebuilder{cache, toolchain, 2};
+            abuild::CodeScanner{cache, 2, [&](abuild::File *file) { prebuilder.add(file); }};
+            expect(prebuilder.dispatchedTasks()).toBe(3u);
+        }
+
+        expect(countInvocations(compiler.projectRoot() / "log")).toBe(3u);
+        expect(cache.taskStates().size()).toBe(3u);
+        expect(cache.errors().size()).toBe(0u);
+
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+        expect(executor.executedTasks()).toBe(cache.buildTasks().size());
+        expect(executor.upToDateTasks()).toBe(3u);
+        expect(countInvocations(compiler.projectRoot() / "log")).toBe(cache.buildTasks().size());
+    });
+
+    test("compiles project header units during code scan", [] {
+        TestProjectWithContent compiler{"abuild_header_unit_prebuilder_compiler",
+                                        {{"compiler.sh", "#!/bin/sh\necho \"$@\" >> \"$(dirname \"$0\")/log\"\nwhile [ $# -gt 0 ]; do\n  if [ \"$1\" = \"-o\" ] || [ \"$1\" = \"rcs\" ]; then mkdir -p \"$(dirname \"$2\")\" && echo output > \"$2\"; fi\n  shift\ndone\n"}}};
+        std::filesystem::permissions(compiler.projectRoot() / "compiler.sh", std::filesystem::perms::owner_all);
+        const abuild::Toolchain toolchain = scriptToolchain(compiler.projectRoot() / "compiler.sh");
+        TestProjectWithContent testProject{"abuild_header_unit_prebuilder_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"\" } }"},
+                                            {"header.hpp", "#include \"detail.hpp\"\nimport <vector>;"},
+                                            {"detail.hpp", "import \"base.hpp\";"},
+                                            {"base.hpp", ""},
+                                            {"modular.hpp", "import mymodule;"},
+                                            {"mymodule.cpp", "export module mymodule;"},
+                                            {"user.cpp", "import \"header.hpp\";\nimport \"modular.hpp\";"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+
+        {
+            abuild::HeaderUnitPrebuilder prebuilder{cache, toolchain, 2};
+            abuild::CodeScanner{cache, 2, [&](abuild::File *file) { prebuilder.add(file); }};
+            expect(prebuilder.dispatchedTasks()).toBe(3u);
+        }
+
+        expect(countInvocations(compiler.projectRoot() / "log")).toBe(3u);
+        expect(cache.taskStates().size()).toBe(3u);
+        expect(cache.errors().size()).toBe(0u);
+
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        const abuild::BuildExecutor executor{cache, toolchain, 2};
+
+        expect(executor.executedTasks()).toBe(cache.buildTasks().size());
+        expect(executor.upToDateTasks()).toBe(3u);
+    });
+
+    test("failed compilation", [] {
+        TestProjectWithContent compiler{"abuild_header_unit_prebuilder_compiler",
+                                        {{"compiler.sh", "#!/bin/sh\nexit 1\n"}}};
+        std::filesystem::permissions(compiler.projectRoot() / "compiler.sh", std::filesystem::perms::owner_all);
+        TestProjectWithContent testProject{"abuild_header_unit_prebuilder_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"\" } }"},
+                                            {"main.cpp", "import <vector>;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::HeaderUnitPrebuilder prebuilder{cache, scriptToolchain(compiler.projectRoot() / "compiler.sh"), 2};
+        prebuilder.add("vector");
+        prebuilder.add("vector");
+        prebuilder.finish();
+
+        expect(prebuilder.dispatchedTasks()).toBe(1u);
+        expect(cache.taskStates().size()).toBe(0u);
+        expect(cache.errors().size()).toBe(1u);
+    });
+});
+#endif
@@ -0,0 +1,135 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+auto rewrite(const std::filesystem::path &path, const std::string &content) -> void
+{
+    const std::filesystem::file_time_type timestamp = std::filesystem::last_write_time(path);
+    std::ofstream{path} << content;
+    std::filesystem::last_write_time(path, timestamp + std::chrono::hours{1});
+}
+
+static const auto testSuite = suite("abuild::IncrementalScanner", [] {
+    test("nothing changed", [] {
+        TestProjectWithContent testProject{"abuild_incremental_scanner_test",
+                                           {{"main.cpp", "#include \"header.hpp\""},
+                                            {"header.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+
+        const abuild::IncrementalScanner scanner{cache};
+
+        expect(scanner.fullScanRequired()).toBe(false);
+        expect(scanner.modifiedFiles()).toBe(0u);
+        expect(scanner.rescannedSources().size()).toBe(0u);
+        expect(scanner.rescannedHeaders().size()).toBe(0u);
+    });
+
+    test("touched file", [] {
+        TestProjectWithContent testProject{"abuild_incremental_scanner_test",
+                                           {{"main.cpp", "#include \"header.hpp\""},
+                                            {"header.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+
+        rewrite(testProject.projectRoot() / "main.cpp", "#include \"header.hpp\"");
+
+        const abuild::IncrementalScanner scanner{cache};
+
+        expect(scanner.fullScanRequired()).toBe(false);
+        expect(scanner.modifiedFiles()).toBe(1u);
+        expect(scanner.rescannedSources().size()).toBe(0u);
+        expect(cache.sources()[0]->isModified()).toBe(false);
+    });
+
+    test("modified source", [] {
+        TestProjectWithContent testProject{"abuild_incremental_scanner_test",
+                                           {{"main.cpp", "#include \"header.hpp\""},
+                                            {"header.hpp", ""},
+                                            {"other.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+
+        rewrite(testProject.projectRoot() / "main.cpp", "#include \"other.hpp\"\n#include <vector>");
+
+        const abuild::IncrementalScanner scanner{cache};
+
+        expect(scanner.fullScanRequired()).toBe(false);
+        assert_(scanner.rescannedSources().size()).toBe(1u);
+        expect(scanner.rescannedHeaders().size()).toBe(0u);
+
+        abuild::Source *source = scanner.rescannedSources()[0];
+
+        expect(source->isModified()).toBe(false);
+        assert_(source->dependencies().size()).toBe(2u);
+        expect(std::get<abuild::IncludeLocalHeaderDependency>(source->dependencies()[0]).header).toBe(cache.header("other.hpp"));
+        expect(std::get<abuild::IncludeSTLHeaderDependency>(source->dependencies()[1]).name).toBe("vector");
+    });
+
+    test("modified header", [] {
+        TestProjectWithContent testProject{"abuild_incremental_scanner_test",
+                                           {{"main.cpp", "#include \"header.hpp\""},
+                                            {"header.hpp", "#include \"missing.hpp\""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+
+        assert_(cache.warnings().size()).toBe(1u);
+
+        rewrite(testProject.projectRoot() / "header.hpp", "#include <string>");
+
+        const abuild::IncrementalScanner scanner{cache};
+
+        expect(scanner.fullScanRequired()).toBe(false);
+        assert_(scanner.rescannedHeaders().size()).toBe(1u);
+        expect(cache.warnings().size()).toBe(0u);
+        assert_(cache.headers()[0]->dependencies().size()).toBe(1u);
+        expect(std::get<abuild::IncludeSTLHeaderDependency>(cache.headers()[0]->dependencies()[0]).name).toBe("string");
+    });
+
+    test("modified module interface", [] {
+        TestProjectWithContent testProject{"abuild_incremental_scanner_test",
+                                           {{"main.cpp", "import mymodule;"},
+                                            {"mymodule.cpp", "export module mymodule;"}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+
+        rewrite(testProject.projectRoot() / "mymodule.cpp", "export module othermodule;");
+
+        expect(abuild::IncrementalScanner{cache}.fullScanRequired()).toBe(true);
+    });
+
+    test("new module interface", [] {
+        TestProjectWithContent testProject{"abuild_incremental_scanner_test",
+                                           {{"main.cpp", "import mymodule;"},
+                                            {"mymodule.cpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+
+        rewrite(testProject.projectRoot() / "mymodule.cpp", "export module mymodule;");
+
+        expect(abuild::IncrementalScanner{cache}.fullScanRequired()).toBe(true);
+    });
+});
@@ -61,7 +61,7 @@ static const auto testSuite = suite("abuild::Module", [] {
         expect(cache.modules()[0]->partitions[0]->name).toBe("mypartition");
         expect(cache.modules()[0]->partitions[0]->visibility).toBe(abuild::ModuleVisibility::Private);
         expect(cache.modules()[0]->partitions[0]->source).toBe(&source2);
-        expect(cache.modules()[0]->partitions[0]->mod).toBe(cache.modules()[0].get());
+        expect(cache.modules()[0]->partitions[0]->mod).toBe(cache.modules()[0]);
     });
 
     test("add module partitions", [] {
@@ -86,12 +86,12 @@ static const auto testSuite = suite("abuild::Module", [] {
         expect(cache.modules()[0]->partitions[0]->name).toBe("mypartition");
         expect(cache.modules()[0]->partitions[0]->visibility).toBe(abuild::ModuleVisibility::Private);
         expect(cache.modules()[0]->partitions[0]->source).toBe(&source2);
-        expect(cache.modules()[0]->partitions[0]->mod).toBe(cache.modules()[0].get());
+        expect(cache.modules()[0]->partitions[0]->mod).toBe(cache.modules()[0]);
 
         expect(cache.modules()[0]->partitions[1]->name).toBe("mypartition2");
         expect(cache.modules()[0]->partitions[1]->visibility).toBe(abuild::ModuleVisibility::Public);
         expect(cache.modules()[0]->partitions[1]->source).toBe(&source3);
-        expect(cache.modules()[0]->partitions[1]->mod).toBe(cache.modules()[0].get());
+        expect(cache.modules()[0]->partitions[1]->mod).toBe(cache.modules()[0]);
     });
 
     test("add module partition before interface", [] {
@@ -116,7 +116,7 @@ static const auto testSuite = suite("abuild::Module", [] {
         expect(cache.modules()[0]->partitions[0]->name).toBe("mypartition");
         expect(cache.modules()[0]->partitions[0]->visibility).toBe(abuild::ModuleVisibility::Public);
         expect(cache.modules()[0]->partitions[0]->source).toBe(&source2);
-        expect(cache.modules()[0]->partitions[0]->mod).toBe(cache.modules()[0].get());
+        expect(cache.modules()[0]->partitions[0]->mod).toBe(cache.modules()[0]);
     });
 
     test("lookup module by name", [] {
@@ -130,7 +130,7 @@ static const auto testSuite = suite("abuild::Module", [] {
         cache.addModuleInterface("mymodule", abuild::ModuleVisibility::Public, &source);
 
         assert_(cache.modules().size()).toBe(1u);
-        expect(cache.cppModule("mymodule")).toBe(cache.modules()[0].get());
+        expect(cache.cppModule("mymodule")).toBe(cache.modules()[0]);
         expect(cache.cppModule("missing_module")).toBe(nullptr);
     });
 
@@ -147,7 +147,7 @@ static const auto testSuite = suite("abuild::Module", [] {
         cache.addModuleInterface("mymodule", abuild::ModuleVisibility::Public, &source1);
 
         assert_(cache.modules().size()).toBe(1u);
-        expect(cache.cppModule(&source1)).toBe(cache.modules()[0].get());
+        expect(cache.cppModule(&source1)).toBe(cache.modules()[0]);
         expect(cache.cppModule(&source2)).toBe(nullptr);
     });
 
@@ -164,7 +164,7 @@ static const auto testSuite = suite("abuild::Module", [] {
         cache.addModulePartition("mymodule", "mypartition", abuild::ModuleVisibility::Public, &source1);
 
         assert_(cache.modules().size()).toBe(1u);
-        expect(cache.cppModulePartition(&source1)->mod).toBe(cache.modules()[0].get());
+        expect(cache.cppModulePartition(&source1)->mod).toBe(cache.modules()[0]);
         expect(cache.cppModulePartition(&source2)).toBe(nullptr);
     });
 });
@@ -118,6 +118,46 @@ static const auto testSuite = suite("abuild::Override (settings)", [] {
         expect(settings.msvcInstallDirectory()).toBe("C:\\my\\dir");
     });
 
+    test("buildDirectory", [] {
+        TestProjectWithContent testProject{"abuild_test_override_test",
+                                           {{".abuild", "{ \"settings\": { \"buildDirectory\": \"out\" } }"}}};
+
+        abuild::Settings settings;
+        abuild::Override{testProject.projectRoot()}.applyOverride(&settings);
+
+        expect(settings.buildDirectory()).toBe("out");
+    });
+
+    test("preambleThreshold", [] {
+        TestProjectWithContent testProject{"abuild_test_override_test",
+                                           {{".abuild", "{ \"settings\": { \"preambleThreshold\": 3 } }"}}};
+
+        abuild::Settings settings;
+        abuild::Override{testProject.projectRoot()}.applyOverride(&settings);
+
+        expect(settings.preambleThreshold()).toBe(3u);
+    });
+
+    test("storeDirectory", [] {
+        TestProjectWithContent testProject{"abuild_test_override_test",
+                                           {{".abuild", "{ \"settings\": { \"storeDirectory\": \"/var/cache/abuild\" } }"}}};
+
+        abuild::Settings settings;
+        abuild::Override{testProject.projectRoot()}.applyOverride(&settings);
+
+        expect(settings.storeDirectory()).toBe("/var/cache/abuild");
+    });
+
+    test("storeSizeLimit", [] {
+        TestProjectWithContent testProject{"abuild_test_override_test",
+                                           {{".abuild", "{ \"settings\": { \"storeSizeLimit\": 1048576 } }"}}};
+
+        abuild::Settings settings;
+        abuild::Override{testProject.projectRoot()}.applyOverride(&settings);
+
+        expect(settings.storeSizeLimit()).toBe(1048576u);
+    });
+
     test("bad value, expected string", [] {
         TestProjectWithContent testProject{"abuild_test_override_test",
                                            {{".abuild", "{ \"settings\": { \"projectNameSeparator\": [ {} ] } }"}}};
@@ -150,4 +190,15 @@ static const auto testSuite = suite("abuild::Override (settings)", [] {
             abuild::Override{testProject.projectRoot()}.applyOverride(&settings);
         }).toThrow<std::runtime_error>("Override error. Value of [\"settings\"][\"testDirectories\"] must be a list of strings.");
     });
-});
\ No newline at end of file
+
+    test("bad value, expected non-negative integer", [] {
+        TestProjectWithContent testProject{"abuild_test_override_test",
+                                           {{".abuild", "{ \"settings\": { \"preambleThreshold\": -1 } }"}}};
+
+        abuild::Settings settings;
+
+        expect([&] {
+            abuild::Override{testProject.projectRoot()}.applyOverride(&settings);
+        }).toThrow<std::runtime_error>("Override error. Value of [\"settings\"][\"preambleThreshold\"] must be a non-negative integer.");
+    });
+});
@@ -30,7 +30,7 @@ static const auto testSuite = suite("abuild::ProjectScanner (headers)", [] {
         assert_(cache.projects().size()).toBe(1u);
 
         expect(cache.headers()[0]->path()).toBe(testProject.projectRoot() / "header.hpp");
-        expect(cache.headers()[0]->project()).toBe(cache.projects()[0].get());
+        expect(cache.headers()[0]->project()).toBe(cache.projects()[0]);
     });
 
     test("multiple headers", [] {
@@ -44,7 +44,7 @@ static const auto testSuite = suite("abuild::ProjectScanner (headers)", [] {
 
         std::vector<std::pair<std::filesystem::path, std::string>> headers;
 
-        for (const std::unique_ptr<abuild::Header> &header : cache.headers())
+        for (abuild::Header *header : cache.headers())
         {
             headers.push_back({header->path(), header->project()->name()});
         }
@@ -69,7 +69,7 @@ static const auto testSuite = suite("abuild::ProjectScanner (headers)", [] {
 
         std::vector<std::pair<std::filesystem::path, std::string>> headers;
 
-        for (const std::unique_ptr<abuild::Header> &header : cache.headers())
+        for (abuild::Header *header : cache.headers())
         {
             headers.push_back({header->path(), header->project()->name()});
         }
@@ -98,7 +98,7 @@ static const auto testSuite = suite("abuild::ProjectScanner (headers)", [] {
 
         std::vector<std::pair<std::filesystem::path, std::string>> headers;
 
-        for (const std::unique_ptr<abuild::Header> &header : cache.headers())
+        for (abuild::Header *header : cache.headers())
         {
             headers.push_back({header->path(), header->project()->name()});
         }
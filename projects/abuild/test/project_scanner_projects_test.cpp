@@ -115,7 +115,7 @@ static const auto testSuite = suite("abuild::ProjectScanner (projects)", [] {
 
         std::vector<std::string> actualProjects;
 
-        for (const std::unique_ptr<abuild::Project> &project : cache.projects())
+        for (abuild::Project *project : cache.projects())
         {
             actualProjects.push_back(project->name());
         }
@@ -146,7 +146,7 @@ static const auto testSuite = suite("abuild::ProjectScanner (projects)", [] {
 
         std::vector<std::pair<std::string, abuild::Project::Type>> actualProjects;
 
-        for (const std::unique_ptr<abuild::Project> &project : cache.projects())
+        for (abuild::Project *project : cache.projects())
         {
             actualProjects.push_back({project->name(), project->type()});
         }
@@ -165,6 +165,46 @@ static const auto testSuite = suite("abuild::ProjectScanner (projects)", [] {
                 {"atest.test", abuild::Project::Type::Executable}});
     });
 
+    test("parallel scan", [] {
+        TestProject testProject{"abuild_project_scanner_test",
+                                {"projects/abuild/src/main.cpp",
+                                 "projects/abuild/test/src/some_test.cpp",
+                                 "projects/acore/include/header.hpp",
+                                 "projects/acore/src/source.cpp",
+                                 "projects/acore/test/other_test.cpp",
+                                 "projects/atest/atest.cpp",
+                                 "projects/atest/include/atest/atest.hpp",
+                                 "projects/atest/test/src/main.cpp"}};
+
+        const auto scan = [&](std::size_t threads) {
+            abuild::BuildCache cache{testProject.projectRoot()};
+            abuild::ProjectScanner{cache, threads};
+
+            std::vector<std::string> actualProjects;
+
+            for (abuild::Project *project : cache.projects())
+            {
+                for (abuild::Source *source : project->sources())
+                {
+                    actualProjects.push_back(project->name() + ": " + source->path().string());
+                }
+
+                for (abuild::Header *header : project->headers())
+                {
+                    actualProjects.push_back(project->name() + ": " + header->path().string());
+                }
+            }
+
+            return actualProjects;
+        };
+
+        const auto sequential = scan(1);
+
+        expect(sequential.size()).toBe(8u);
+        expect(scan(4)).toBe(sequential);
+        expect(scan(4)).toBe(sequential);
+    });
+
     test("sources", [] {
         TestProject testProject{"abuild_project_scanner_test",
                                 {"projects/abuild/main.cpp",
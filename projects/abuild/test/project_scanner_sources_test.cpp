@@ -30,7 +30,7 @@ static const auto testSuite = suite("abuild::ProjectScanner (sources)", [] {
         assert_(cache.projects().size()).toBe(1u);
 
         expect(cache.sources()[0]->path()).toBe(testProject.projectRoot() / "main.cpp");
-        expect(cache.sources()[0]->project()).toBe(cache.projects()[0].get());
+        expect(cache.sources()[0]->project()).toBe(cache.projects()[0]);
     });
 
     test("multiple sources", [] {
@@ -44,7 +44,7 @@ static const auto testSuite = suite("abuild::ProjectScanner (sources)", [] {
 
         std::vector<std::pair<std::filesystem::path, std::string>> sources;
 
-        for (const std::unique_ptr<abuild::Source> &source : cache.sources())
+        for (abuild::Source *source : cache.sources())
         {
             sources.push_back({source->path(), source->project()->name()});
         }
@@ -69,7 +69,7 @@ static const auto testSuite = suite("abuild::ProjectScanner (sources)", [] {
 
         std::vector<std::pair<std::filesystem::path, std::string>> sources;
 
-        for (const std::unique_ptr<abuild::Source> &source : cache.sources())
+        for (abuild::Source *source : cache.sources())
         {
             sources.push_back({source->path(), source->project()->name()});
         }
@@ -98,7 +98,7 @@ static const auto testSuite = suite("abuild::ProjectScanner (sources)", [] {
 
         std::vector<std::pair<std::filesystem::path, std::string>> sources;
 
-        for (const std::unique_ptr<abuild::Source> &source : cache.sources())
+        for (abuild::Source *source : cache.sources())
         {
             sources.push_back({source->path(), source->project()->name()});
         }
@@ -40,6 +40,6 @@ static const auto testSuite = suite("abuild::Project", [] {
 
         assert_(cache.projects().size()).toBe(1u);
         expect(cache.project("abuild_project_scanner_test")).toBe(nullptr);
-        expect(cache.project("abuild")).toBe(cache.projects()[0].get());
+        expect(cache.project("abuild")).toBe(cache.projects()[0]);
     });
 });
@@ -91,4 +91,24 @@ static const auto testSuite = suite("abuild::Settings", [] {
     test("MSVC install directory", [] {
         expect(abuild::Settings{}.msvcInstallDirectory()).toBe("C:/Program Files (x86)/Microsoft Visual Studio/");
     });
+
+    test("build directory", [] {
+        expect(abuild::Settings{}.buildDirectory()).toBe("build");
+    });
+
+    test("preamble threshold", [] {
+        expect(abuild::Settings{}.preambleThreshold()).toBe(0u);
+    });
+
+    test("store directory", [] {
+#ifdef _WIN32
+        expect(abuild::Settings{}.storeDirectory().ends_with("abuild/store")).toBe(true);
+#else
+        expect(abuild::Settings{}.storeDirectory().ends_with(".abuild/store")).toBe(true);
+#endif
+    });
+
+    test("store size limit", [] {
+        expect(abuild::Settings{}.storeSizeLimit()).toBe(std::uint64_t{5} * 1024 * 1024 * 1024);
+    });
 });
@@ -0,0 +1,134 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+static const auto testSuite = suite("abuild::ThreadPool", [] {
+    test("thread count", [] {
+        expect(abuild::ThreadPool{4}.threadCount()).toBe(4u);
+    });
+
+    test("at least one thread", [] {
+        expect(abuild::ThreadPool{0}.threadCount()).toBe(1u);
+    });
+
+    test("run jobs", [] {
+        abuild::ThreadPool pool{4};
+        std::atomic<int> counter = 0;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            pool.run([&] { counter++; });
+        }
+
+        pool.wait();
+
+        expect(counter.load()).toBe(100);
+    });
+
+    test("jobs scheduled from jobs", [] {
+        abuild::ThreadPool pool{2};
+        std::atomic<int> counter = 0;
+
+        for (int i = 0; i < 10; ++i)
+        {
+            pool.run([&] {
+                counter++;
+
+                for (int j = 0; j < 10; ++j)
+                {
+                    pool.run([&] { counter++; });
+                }
+            });
+        }
+
+        pool.wait();
+
+        expect(counter.load()).toBe(110);
+    });
+
+    test("priority", [] {
+        abuild::ThreadPool pool{1};
+        std::promise<void> started;
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        std::vector<int> order;
+
+        pool.run([&] {
+            started.set_value();
+            released.wait();
+        });
+
+        started.get_future().wait();
+        pool.run([&] { order.push_back(1); }, 1);
+        pool.run([&] { order.push_back(3); }, 3);
+        pool.run([&] { order.push_back(2); }, 2);
+        pool.run([&] { order.push_back(4); }, 3);
+        release.set_value();
+        pool.wait();
+
+        expect(order).toBe(std::vector<int>{3, 4, 2, 1});
+    });
+
+    test("priority across workers", [] {
+        abuild::ThreadPool pool{2};
+        std::promise<void> firstStarted;
+        std::promise<void> secondStarted;
+        std::promise<void> releaseFirst;
+        std::promise<void> releaseSecond;
+        std::promise<void> highScheduled;
+        std::promise<void> finished;
+        std::shared_future<void> firstReleased = releaseFirst.get_future().share();
+        std::shared_future<void> secondReleased = releaseSecond.get_future().share();
+        std::shared_future<void> allFinished = finished.get_future().share();
+        std::vector<int> order;
+
+        const auto append = [&](int value) {
+            order.push_back(value);
+
+            if (order.size() == 3)
+            {
+                finished.set_value();
+            }
+        };
+
+        pool.run([&] {
+            firstStarted.set_value();
+            firstReleased.wait();
+            pool.run([&] { append(1); }, 1);
+            pool.run([&] { append(1); }, 1);
+        });
+
+        pool.run([&] {
+            secondStarted.set_value();
+            secondReleased.wait();
+            pool.run([&] { append(5); }, 5);
+            highScheduled.set_value();
+            allFinished.wait();
+        });
+
+        firstStarted.get_future().wait();
+        secondStarted.get_future().wait();
+        releaseSecond.set_value();
+        highScheduled.get_future().wait();
+        releaseFirst.set_value();
+        pool.wait();
+
+        expect(order).toBe(std::vector<int>{5, 1, 1});
+    });
+
+    test("exception", [] {
+        abuild::ThreadPool pool{2};
+        std::atomic<int> counter = 0;
+
+        pool.run([] { throw std::runtime_error{"job failed"}; });
+        pool.run([&] { counter++; });
+
+        expect([&] { pool.wait(); }).toThrow<std::runtime_error>("job failed");
+        expect(counter.load()).toBe(1);
+    });
+});
@@ -153,6 +153,7 @@ static const auto testSuite = suite("abuild::Tokenizer", [] {
         expect(abuild::Tokenizer{"   module     mymodule   ;"}.next()).toBe(abuild::Token{abuild::ModuleToken{.name = "mymodule", .visibility = abuild::TokenVisibility::Private}});
         expect(abuild::Tokenizer{"module\nmymodule\n;"}.next()).toBe(abuild::Token{abuild::ModuleToken{.name = "mymodule", .visibility = abuild::TokenVisibility::Private}});
         expect(abuild::Tokenizer{"/*\n\n*/module/*\n\n*/mymodule/*\n\n*/;"}.next()).toBe(abuild::Token{abuild::ModuleToken{.name = "mymodule", .visibility = abuild::TokenVisibility::Private}});
+        expect(abuild::Tokenizer{"module my/*\n\n*/module;"}.next()).toBe(abuild::Token{abuild::ModuleToken{.name = "mymodule", .visibility = abuild::TokenVisibility::Private}});
     });
 
     test("bad module", [] {
@@ -328,6 +329,82 @@ static const auto testSuite = suite("abuild::Tokenizer", [] {
             abuild::Token{abuild::ImportModuleToken{.name = "yetanothermodule", .visibility = abuild::TokenVisibility::Private}}});
     });
 
+    test("long lines", [] {
+        abuild::Tokenizer tokenizer{"const std::vector<int> values = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};\n"
+                                    "const char *text = \"a rather long string literal with an \\\"escaped\\\" quote and import fake; inside\";\n"
+                                    "/* a multi-line comment that spans well over\n * thirty two characters * / import fake; */import mymodule;\n"
+                                    "// a single line comment that is longer than thirty two characters import fake;\n"
+                                    "#include \"header.hpp\""};
+        std::vector<abuild::Token> tokens;
+
+        for (abuild::Token token = tokenizer.next(); token != abuild::Token{}; token = tokenizer.next())
+        {
+            tokens.push_back(std::move(token));
+        }
+
+        expect(tokens).toBe(std::vector<abuild::Token>{
+            abuild::Token{abuild::ImportModuleToken{.name = "mymodule", .visibility = abuild::TokenVisibility::Private}},
+            abuild::Token{abuild::IncludeLocalToken{.name = "header.hpp"}}});
+    });
+
+    test("preamble of a module unit", [] {
+        const std::string_view content = "module;\n#include \"header.hpp\"\n#include <cassert>\nexport module mymodule;\n// imports\nimport <vector>;\nexport import othermodule;\n#ifdef FEATURE\nimport : mypartition;\n#endif\n;\nexport import \"other_header.hpp\";\nimport /* comment */ : otherpartition;\nclass Foo\n{\n    int a;\n    int b;\n};\nexport auto foo() -> void;";
+        const std::vector<abuild::Token> expected{
+            abuild::Token{abuild::IncludeLocalToken{.name = "header.hpp"}},
+            abuild::Token{abuild::IncludeExternalToken{.name = "cassert"}},
+            abuild::Token{abuild::ModuleToken{.name = "mymodule", .visibility = abuild::TokenVisibility::Exported}},
+            abuild::Token{abuild::ImportIncludeExternalToken{.name = "vector", .visibility = abuild::TokenVisibility::Private}},
+            abuild::Token{abuild::ImportModuleToken{.name = "othermodule", .visibility = abuild::TokenVisibility::Exported}},
+            abuild::Token{abuild::ImportModulePartitionToken{.name = "mypartition", .visibility = abuild::TokenVisibility::Private}},
+            abuild::Token{abuild::ImportIncludeLocalToken{.name = "other_header.hpp", .visibility = abuild::TokenVisibility::Exported}},
+            abuild::Token{abuild::ImportModulePartitionToken{.name = "otherpartition", .visibility = abuild::TokenVisibility::Private}}};
+
+        for (std::size_t threshold : {0, 1, 2, 100})
+        {
+            std::vector<abuild::Token> tokens;
+            abuild::Tokenizer tokenizer{content, threshold};
+
+            for (abuild::Token token = tokenizer.next(); token != abuild::Token{}; token = tokenizer.next())
+            {
+                tokens.push_back(std::move(token));
+            }
+
+            expect(tokens).toBe(expected);
+        }
+    });
+
+    test("preamble of a module unit ends at the first declaration", [] {
+        const std::string_view content = "module mymodule;\nimport othermodule;\nauto foo() -> void\n{\n}\n\nimport : mypartition;";
+        std::vector<abuild::Token> tokens;
+        abuild::Tokenizer tokenizer{content, 100};
+
+        for (abuild::Token token = tokenizer.next(); token != abuild::Token{}; token = tokenizer.next())
+        {
+            tokens.push_back(std::move(token));
+        }
+
+        expect(tokens).toBe(std::vector<abuild::Token>{
+            abuild::Token{abuild::ModuleToken{.name = "mymodule", .visibility = abuild::TokenVisibility::Private}},
+            abuild::Token{abuild::ImportModuleToken{.name = "othermodule", .visibility = abuild::TokenVisibility::Private}}});
+    });
+
+    test("preamble threshold", [] {
+        const std::string_view content = "#include \"header.hpp\"\nclass Foo;\n#include <vector>\nclass Bar;\n#include \"other_header.hpp\"";
+
+        for (std::size_t threshold : {1, 2, 0})
+        {
+            std::vector<abuild::Token> tokens;
+            abuild::Tokenizer tokenizer{content, threshold};
+
+            for (abuild::Token token = tokenizer.next(); token != abuild::Token{}; token = tokenizer.next())
+            {
+                tokens.push_back(std::move(token));
+            }
+
+            expect(tokens.size()).toBe(threshold == 0 ? 3u : threshold);
+        }
+    });
+
     test("comment at the end of file", [] {
         expect(abuild::Tokenizer{"unsigned int foo(); // expected-error {{C++ requires a type specifier for all declarations}}"}.next()).toBe(abuild::Token{});
     });
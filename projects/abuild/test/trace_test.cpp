@@ -0,0 +1,136 @@
+import abuild_test_utilities;
+
+using atest::assert_;
+using atest::assert_fail;
+using atest::expect;
+using atest::expect_fail;
+using atest::suite;
+using atest::test;
+
+static const auto testSuite = suite("abuild::Trace", [] {
+    test("span", [] {
+        abuild::Trace trace;
+
+        {
+            const abuild::TraceSpan span{trace, "test", "span"};
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+
+        const std::vector<abuild::TraceEvent> events = trace.events();
+
+        assert_(events.size()).toBe(1u);
+        expect(events[0].name).toBe("span");
+        expect(std::string{events[0].category}).toBe("test");
+        expect(events[0].duration >= std::chrono::milliseconds{1}).toBe(true);
+        expect(events[0].thread).toBe(1u);
+    });
+
+    test("disabled", [] {
+        abuild::Trace trace;
+        trace.setEnabled(false);
+
+        {
+            const abuild::TraceSpan span{trace, "test", "span"};
+        }
+
+        expect(trace.enabled()).toBe(false);
+        expect(trace.events().empty()).toBe(true);
+    });
+
+    test("disabled name", [] {
+        abuild::Trace trace;
+        trace.setEnabled(false);
+        bool named = false;
+
+        {
+            const abuild::TraceSpan span{trace, "test", [&] {
+                                             named = true;
+                                             return std::string{"span"};
+                                         }};
+        }
+
+        expect(named).toBe(false);
+        expect(trace.events().empty()).toBe(true);
+    });
+
+    test("clear", [] {
+        abuild::Trace trace;
+
+        {
+            const abuild::TraceSpan span{trace, "test", "span"};
+        }
+
+        trace.clear();
+
+        {
+            const abuild::TraceSpan span{trace, "test", "other"};
+        }
+
+        assert_(trace.events().size()).toBe(1u);
+        expect(trace.events()[0].name).toBe("other");
+    });
+
+    test("threads", [] {
+        abuild::Trace trace;
+
+        {
+            const abuild::TraceSpan span{trace, "test", "main"};
+            std::thread thread{[&] { const abuild::TraceSpan threadSpan{trace, "test", "thread"}; }};
+            thread.join();
+        }
+
+        const std::vector<abuild::TraceEvent> events = trace.events();
+
+        assert_(events.size()).toBe(2u);
+        expect(events[0].name).toBe("main");
+        expect(events[1].name).toBe("thread");
+        expect(events[0].thread != events[1].thread).toBe(true);
+    });
+
+    test("json", [] {
+        abuild::Trace trace;
+
+        {
+            const abuild::TraceSpan span{trace, "test", "span \"quoted\""};
+        }
+
+        rapidjson::Document document;
+        document.Parse(trace.json().c_str());
+
+        assert_(document.HasParseError()).toBe(false);
+        assert_(document["traceEvents"].Size()).toBe(1u);
+        expect(std::string{document["traceEvents"][0]["name"].GetString()}).toBe("span \"quoted\"");
+        expect(std::string{document["traceEvents"][0]["cat"].GetString()}).toBe("test");
+        expect(std::string{document["traceEvents"][0]["ph"].GetString()}).toBe("X");
+        expect(document["traceEvents"][0]["tid"].GetUint()).toBe(1u);
+        expect(document["traceEvents"][0].HasMember("ts")).toBe(true);
+        expect(document["traceEvents"][0].HasMember("dur")).toBe(true);
+    });
+
+    test("scanners", [] {
+        TestProjectWithContent testProject{"abuild_trace_test",
+                                           {{"main.cpp", "#include \"header.hpp\""},
+                                            {"header.hpp", ""}}};
+
+        abuild::BuildCache cache{testProject.projectRoot()};
+        abuild::ProjectScanner{cache};
+        abuild::CodeScanner{cache};
+        abuild::DependencyScanner{cache};
+        abuild::BuildGraph{cache};
+
+        std::unordered_set<std::string> names;
+
+        for (const abuild::TraceEvent &event : cache.trace().events())
+        {
+            names.insert(event.name);
+        }
+
+        expect(names.contains("ProjectScanner")).toBe(true);
+        expect(names.contains(testProject.projectRoot().string())).toBe(true);
+        expect(names.contains("CodeScanner")).toBe(true);
+        expect(names.contains((testProject.projectRoot() / "main.cpp").string())).toBe(true);
+        expect(names.contains((testProject.projectRoot() / "header.hpp").string())).toBe(true);
+        expect(names.contains("DependencyScanner")).toBe(true);
+        expect(names.contains("BuildGraph")).toBe(true);
+    });
+});
@@ -0,0 +1,247 @@
+#ifdef _MSC_VER
+export module abuild : thread_pool;
+export import<astl.hpp>;
+#endif
+
+namespace abuild
+{
+export class ThreadPool
+{
+public:
+    ThreadPool() :
+        ThreadPool{std::thread::hardware_concurrency()}
+    {
+    }
+
+    explicit ThreadPool(std::size_t threads)
+    {
+        const std::size_t count = std::max<std::size_t>(threads, 1);
+        mQueues.reserve(count);
+        mThreads.reserve(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            mQueues.push_back(std::make_unique<Queue>());
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            mThreads.emplace_back([this, i] { work(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool &other) = delete;
+    ThreadPool(ThreadPool &&other) noexcept = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::scoped_lock lock{mMutex};
+            mStopping = true;
+        }
+
+        mWorkAvailable.notify_all();
+
+        for (std::thread &thread : mThreads)
+        {
+            thread.join();
+        }
+    }
+
+    auto run(std::function<void()> job) -> void
+    {
+        push(mQueues[targetQueue()].get(), Job{.priority = 0, .sequence = mSequence++, .function = std::move(job)});
+    }
+
+    auto run(std::function<void()> job, std::int64_t priority) -> void
+    {
+        push(&mPrioritised, Job{.priority = priority, .sequence = mSequence++, .function = std::move(job)});
+    }
+
+    [[nodiscard]] auto threadCount() const noexcept -> std::size_t
+    {
+        return mThreads.size();
+    }
+
+    auto wait() -> void
+    {
+        std::unique_lock lock{mMutex};
+        mWorkFinished.wait(lock, [&] { return mUnfinished == 0; });
+
+        if (mException)
+        {
+            std::rethrow_exception(std::exchange(mException, nullptr));
+        }
+    }
+
+    auto operator=(const ThreadPool &other) -> ThreadPool & = delete;
+    auto operator=(ThreadPool &&other) noexcept -> ThreadPool & = delete;
+
+private:
+    struct Job
+    {
+        std::int64_t priority = 0;
+        std::uint64_t sequence = 0;
+        std::function<void()> function;
+
+        [[nodiscard]] auto operator<(const Job &other) const noexcept -> bool
+        {
+            if (priority != other.priority)
+            {
+                return priority < other.priority;
+            }
+
+            return other.sequence < sequence;
+        }
+    };
+
+    struct Queue
+    {
+        std::mutex mutex;
+        std::vector<Job> jobs;
+    };
+
+    auto execute(Job &job) -> void
+    {
+        try
+        {
+            job.function();
+        }
+        catch (...)
+        {
+            std::scoped_lock lock{mMutex};
+
+            if (!mException)
+            {
+                mException = std::current_exception();
+            }
+        }
+
+        bool finished = false;
+
+        {
+            std::scoped_lock lock{mMutex};
+            finished = --mUnfinished == 0;
+        }
+
+        if (finished)
+        {
+            mWorkFinished.notify_all();
+        }
+    }
+
+    [[nodiscard]] auto pop(std::size_t index, Job *job) -> bool
+    {
+        {
+            Queue &queue = *mQueues[index];
+            std::scoped_lock lock{queue.mutex, mPrioritised.mutex};
+
+            if (!mPrioritised.jobs.empty() && (queue.jobs.empty() || queue.jobs.front() < mPrioritised.jobs.front()))
+            {
+                return pop(&mPrioritised, job);
+            }
+
+            if (!queue.jobs.empty())
+            {
+                return pop(&queue, job);
+            }
+        }
+
+        for (std::size_t i = 1; i < mQueues.size(); ++i)
+        {
+            Queue &queue = *mQueues[(index + i) % mQueues.size()];
+            std::scoped_lock lock{queue.mutex};
+
+            if (!queue.jobs.empty())
+            {
+                return pop(&queue, job);
+            }
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] static auto pop(Queue *queue, Job *job) -> bool
+    {
+        std::pop_heap(queue->jobs.begin(), queue->jobs.end());
+        *job = std::move(queue->jobs.back());
+        queue->jobs.pop_back();
+        return true;
+    }
+
+    auto push(Queue *queue, Job job) -> void
+    {
+        {
+            std::scoped_lock lock{queue->mutex};
+            queue->jobs.push_back(std::move(job));
+            std::push_heap(queue->jobs.begin(), queue->jobs.end());
+        }
+
+        {
+            std::scoped_lock lock{mMutex};
+            mQueued++;
+            mUnfinished++;
+        }
+
+        mWorkAvailable.notify_one();
+    }
+
+    [[nodiscard]] auto reserveJob() -> bool
+    {
+        std::unique_lock lock{mMutex};
+        mWorkAvailable.wait(lock, [&] { return mStopping || mQueued != 0; });
+
+        if (mQueued == 0)
+        {
+            return false;
+        }
+
+        mQueued--;
+        return true;
+    }
+
+    [[nodiscard]] auto targetQueue() -> std::size_t
+    {
+        if (tCurrentPool == this)
+        {
+            return tCurrentQueue;
+        }
+
+        return mNextQueue++ % mQueues.size();
+    }
+
+    auto work(std::size_t index) -> void
+    {
+        tCurrentPool = this;
+        tCurrentQueue = index;
+
+        while (reserveJob())
+        {
+            Job job;
+
+            while (!pop(index, &job))
+            {
+                std::this_thread::yield();
+            }
+
+            execute(job);
+        }
+    }
+
+    static inline thread_local ThreadPool *tCurrentPool = nullptr;
+    static inline thread_local std::size_t tCurrentQueue = 0;
+
+    std::vector<std::unique_ptr<Queue>> mQueues;
+    Queue mPrioritised;
+    std::vector<std::thread> mThreads;
+    std::atomic<std::uint64_t> mSequence = 0;
+    std::atomic<std::size_t> mNextQueue = 0;
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailable;
+    std::condition_variable mWorkFinished;
+    std::size_t mQueued = 0;
+    std::size_t mUnfinished = 0;
+    std::exception_ptr mException;
+    bool mStopping = false;
+};
+}
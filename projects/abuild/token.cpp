@@ -12,48 +12,48 @@ export enum class TokenVisibility {
 
 export struct IncludeLocalToken
 {
-    std::string name;
+    std::string_view name;
 };
 
 export struct IncludeExternalToken
 {
-    std::string name;
+    std::string_view name;
 };
 
 export struct ModuleToken
 {
-    std::string name;
+    std::string_view name;
     TokenVisibility visibility = TokenVisibility::Private;
 };
 
 export struct ModulePartitionToken
 {
-    std::string name;
-    std::string mod;
+    std::string_view name;
+    std::string_view mod;
     TokenVisibility visibility = TokenVisibility::Private;
 };
 
 export struct ImportModuleToken
 {
-    std::string name;
+    std::string_view name;
     TokenVisibility visibility = TokenVisibility::Private;
 };
 
 export struct ImportIncludeLocalToken
 {
-    std::string name;
+    std::string_view name;
     TokenVisibility visibility = TokenVisibility::Private;
 };
 
 export struct ImportIncludeExternalToken
 {
-    std::string name;
+    std::string_view name;
     TokenVisibility visibility = TokenVisibility::Private;
 };
 
 export struct ImportModulePartitionToken
 {
-    std::string name;
+    std::string_view name;
     TokenVisibility visibility = TokenVisibility::Private;
 };
 
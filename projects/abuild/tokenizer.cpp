@@ -1,6 +1,7 @@
 #ifdef _MSC_VER
 export module abuild : tokenizer;
 export import : token;
+import : character_search;
 #endif
 
 namespace abuild
@@ -12,8 +13,14 @@ struct BadTokenError
 export class Tokenizer
 {
 public:
-    explicit Tokenizer(const std::string &content) :
-        mContent{content}
+    explicit Tokenizer(std::string_view content) :
+        Tokenizer{content, 0}
+    {
+    }
+
+    Tokenizer(std::string_view content, std::size_t preambleThreshold) :
+        mContent{content},
+        mPreambleThreshold{preambleThreshold}
     {
     }
 
@@ -27,7 +34,7 @@ public:
 
                 if (!atEnd())
                 {
-                    const char c = mContent[pos++];
+                    const char c = at(pos++);
 
                     if (c == '#')
                     {
@@ -48,7 +55,7 @@ public:
                         }
                         else
                         {
-                            skipToSemicolonOrLine();
+                            skipDeclaration();
                         }
                     }
                     else if (c == 'm')
@@ -57,9 +64,13 @@ public:
                         {
                             return extractModule(TokenVisibility::Private);
                         }
+                        else if (at(pos) == ';')
+                        {
+                            pos++;
+                        }
                         else
                         {
-                            skipToSemicolonOrLine();
+                            skipDeclaration();
                         }
                     }
                     else if (c == 'e')
@@ -70,12 +81,12 @@ public:
                         }
                         else
                         {
-                            skipToSemicolonOrLine();
+                            skipDeclaration();
                         }
                     }
-                    else
+                    else if (c != ';')
                     {
-                        skipToSemicolonOrLine();
+                        skipDeclaration();
                     }
                 }
             }
@@ -88,6 +99,11 @@ public:
     }
 
 private:
+    [[nodiscard]] auto at(std::size_t position) const noexcept -> char
+    {
+        return position < mContent.size() ? mContent[position] : '\0';
+    }
+
     [[nodiscard]] auto atEnd() const noexcept -> bool
     {
         return pos >= mContent.size();
@@ -101,11 +117,11 @@ private:
 
     [[nodiscard]] auto extractExportToken() -> Token
     {
-        if (mContent[pos] == 'i')
+        if (at(pos) == 'i')
         {
             return extractExportImport();
         }
-        else if (mContent[pos] == 'm')
+        else if (at(pos) == 'm')
         {
             return extractExportModule();
         }
@@ -133,18 +149,18 @@ private:
     {
         skipWhiteSpaceOrComment();
 
-        if (mContent[pos] == ':')
+        if (at(pos) == ':')
         {
             pos++;
             skipWhiteSpaceOrComment();
             return ImportModulePartitionToken{.name = extractImportNameTill(';'), .visibility = visibility};
         }
-        else if (mContent[pos] == '"')
+        else if (at(pos) == '"')
         {
             pos++;
             return ImportIncludeLocalToken{.name = extractImportNameTill('"'), .visibility = visibility};
         }
-        else if (mContent[pos] == '<')
+        else if (at(pos) == '<')
         {
             pos++;
             return ImportIncludeExternalToken{.name = extractImportNameTill('>'), .visibility = visibility};
@@ -155,9 +171,9 @@ private:
         }
     }
 
-    [[nodiscard]] auto extractImportNameTill(const char separator) -> std::string
+    [[nodiscard]] auto extractImportNameTill(const char separator) -> std::string_view
     {
-        std::string name;
+        std::string_view name;
 
         if (separator == '"' || separator == '>')
         {
@@ -174,53 +190,61 @@ private:
 
     [[nodiscard]] auto extractInclude() -> Token
     {
-        if (mContent[pos++] == '"')
+        Token token;
+
+        if (at(pos++) == '"')
         {
-            return IncludeLocalToken{.name = extractIncludeName('"')};
+            token = IncludeLocalToken{.name = extractIncludeName('"')};
         }
         else
         {
-            return IncludeExternalToken{.name = extractIncludeName('>')};
+            token = IncludeExternalToken{.name = extractIncludeName('>')};
         }
+
+        skipLine();
+        return token;
     }
 
     [[nodiscard]] auto extractModule(TokenVisibility visibility) -> Token
     {
-        std::string tokenName = extractTokenName();
+        const std::string_view tokenName = extractTokenName();
+        mModuleUnit = true;
 
-        if (mContent[pos++] == ':')
+        if (at(pos++) == ':')
         {
             skipWhiteSpaceOrComment();
-            return ModulePartitionToken{.name = extractTokenName(), .mod = std::move(tokenName), .visibility = visibility};
+            return ModulePartitionToken{.name = extractTokenName(), .mod = tokenName, .visibility = visibility};
         }
         else
         {
-            return ModuleToken{.name = std::move(tokenName), .visibility = visibility};
+            return ModuleToken{.name = tokenName, .visibility = visibility};
         }
     }
 
-    [[nodiscard]] auto extractIncludeName(const char separator) -> std::string
+    [[nodiscard]] auto extractIncludeName(const char separator) -> std::string_view
     {
-        std::string name;
+        const std::size_t start = pos;
 
-        while (!atEnd() && mContent[pos] != separator && mContent[pos] != '\n')
+        while (!atEnd() && at(pos) != separator && at(pos) != '\n')
         {
-            name += mContent[pos++];
+            pos++;
         }
 
-        if (mContent[pos] != separator)
+        if (at(pos) != separator)
         {
             throw BadTokenError{};
         }
 
-        return name;
+        return mContent.substr(start, pos - start);
     }
 
-    [[nodiscard]] auto extractTokenName() -> std::string
+    [[nodiscard]] auto extractTokenName() -> std::string_view
     {
-        std::string name;
+        const std::size_t start = pos;
+        std::size_t end = pos;
+        bool split = false;
 
-        while (!atEnd() && mContent[pos] != ':' && mContent[pos] != ';' && !std::isspace(mContent[pos]))
+        while (!atEnd() && at(pos) != ':' && at(pos) != ';' && !std::isspace(at(pos)))
         {
             if (isComment())
             {
@@ -228,36 +252,42 @@ private:
             }
             else
             {
-                name += mContent[pos++];
+                split = split || pos != end;
+                end = ++pos;
             }
         }
 
         skipWhiteSpaceOrComment();
 
-        if (mContent[pos] != ':' && mContent[pos] != ';')
+        if (at(pos) != ':' && at(pos) != ';')
         {
             throw BadTokenError{};
         }
 
-        return trim(name);
+        if (split)
+        {
+            return joinName(start, end);
+        }
+
+        return trim(mContent.substr(start, end - start));
     }
 
     [[nodiscard]] auto isComment() -> bool
     {
-        return mContent[pos] == '/' && mContent[pos + 1] == '*';
+        return at(pos) == '/' && at(pos + 1) == '*';
     }
 
     [[nodiscard]] auto isExport() -> bool
     {
-        const std::string EXPORT = "xport";
+        constexpr std::string_view EXPORT = "xport";
 
         if (mContent.substr(pos, EXPORT.size()) == EXPORT)
         {
             pos += EXPORT.size();
 
-            const bool result = std::isspace(mContent[pos]) || isComment();
+            const bool result = std::isspace(at(pos)) || isComment();
             skipWhiteSpaceOrComment();
-            const std::string what = mContent.substr(pos, 6);
+            const std::string_view what = mContent.substr(pos, 6);
             return result && (what == "import" || what == "module");
         }
 
@@ -266,12 +296,12 @@ private:
 
     [[nodiscard]] auto isImport() -> bool
     {
-        const std::string IMPORT = "mport";
+        constexpr std::string_view IMPORT = "mport";
 
         if (mContent.substr(pos, IMPORT.size()) == IMPORT)
         {
             pos += IMPORT.size();
-            return std::isspace(mContent[pos]) || mContent[pos] == '"' || mContent[pos] == '<' || mContent[pos] == ':' || isComment();
+            return std::isspace(at(pos)) || at(pos) == '"' || at(pos) == '<' || at(pos) == ':' || isComment();
         }
 
         return false;
@@ -279,14 +309,14 @@ private:
 
     [[nodiscard]] auto isInclude() -> bool
     {
-        const std::string INCLUDE = "include";
+        constexpr std::string_view INCLUDE = "include";
         skipWhiteSpaceOrComment();
 
         if (mContent.substr(pos, INCLUDE.size()) == INCLUDE)
         {
             pos += INCLUDE.size();
             skipWhiteSpaceOrComment();
-            return mContent[pos] == '"' || mContent[pos] == '<';
+            return at(pos) == '"' || at(pos) == '<';
         }
 
         return false;
@@ -294,12 +324,12 @@ private:
 
     [[nodiscard]] auto isModule() -> bool
     {
-        const std::string MODULE = "odule";
+        constexpr std::string_view MODULE = "odule";
 
         if (mContent.substr(pos, MODULE.size()) == MODULE)
         {
             pos += MODULE.size();
-            const bool result = std::isspace(mContent[pos]) || isComment();
+            const bool result = std::isspace(at(pos)) || isComment();
             skipWhiteSpaceOrComment();
             return result;
         }
@@ -307,26 +337,33 @@ private:
         return false;
     }
 
-    [[nodiscard]] auto matchSequence(const std::string &sequence) -> bool
+    [[nodiscard]] auto joinName(std::size_t start, std::size_t end) -> std::string_view
     {
-        for (const char c : sequence)
+        std::string &name = mJoinedNames.emplace_back();
+
+        while (start < end)
         {
-            if (mContent[pos++] != c || atEnd())
+            if (at(start) == '/' && at(start + 1) == '*')
+            {
+                const std::size_t commentEnd = mContent.find("*/", start + 2);
+                start = commentEnd == std::string_view::npos ? end : commentEnd + 2;
+            }
+            else
             {
-                return false;
+                name += at(start++);
             }
         }
 
-        return true;
+        return name;
     }
 
     auto skipComment() -> void
     {
-        if (mContent[pos] == '/')
+        if (at(pos) == '/')
         {
             skipLine();
         }
-        else if (mContent[pos] == '*')
+        else if (at(pos) == '*')
         {
             skipMultiLineComment();
         }
@@ -336,45 +373,50 @@ private:
         }
     }
 
-    auto skipLine() -> void
+    auto skipDeclaration() -> void
     {
-        while (!atEnd() && mContent[pos] != '\n')
+        skipToSemicolonOrLine();
+
+        if (mPreambleThreshold != 0 && (mModuleUnit || ++mDeclarations == mPreambleThreshold))
         {
-            pos++;
+            pos = mContent.size();
         }
-
-        pos++;
     }
 
-    auto skipRawString() -> void
+    auto skipLine() -> void
     {
-        const std::string sequence = skipSequence();
-
-        while (!matchSequence(sequence) && !atEnd())
-        {
-        }
+        pos = findFirstOf<'\n'>(mContent, pos) + 1;
     }
 
-    [[nodiscard]] auto skipSequence() -> std::string
+    auto skipRawString() -> void
     {
-        std::string sequence{')'};
+        const std::size_t start = pos;
 
-        while (!atEnd() && mContent[pos] != '(')
+        while (!atEnd() && at(pos) != '(')
         {
-            sequence += mContent[pos++];
+            pos++;
         }
 
+        const std::string_view delimiter = mContent.substr(start, pos - start);
         pos++;
-        sequence += '"';
 
-        return sequence;
+        while (!atEnd())
+        {
+            if (at(pos) == ')' && mContent.substr(pos + 1, delimiter.size()) == delimiter && at(pos + 1 + delimiter.size()) == '"')
+            {
+                pos += delimiter.size() + 2;
+                return;
+            }
+
+            pos++;
+        }
     }
 
     auto skipStringLiteral() -> void
     {
         pos++;
 
-        if (mContent[pos - 2] == 'R')
+        if (at(pos - 2) == 'R')
         {
             skipRawString();
         }
@@ -386,26 +428,34 @@ private:
 
     auto skipString() -> void
     {
-        while (!atEnd() && !(mContent[pos++] == '"' && mContent[pos - 2] != '\\'))
+        while (!atEnd())
         {
+            pos = findFirstOf<'"'>(mContent, pos) + 1;
+
+            if (at(pos - 2) != '\\')
+            {
+                return;
+            }
         }
     }
 
     auto skipToSemicolonOrLine() -> void
     {
-        while (!atEnd() && mContent[pos] != ';' && mContent[pos] != '\n')
+        while (!atEnd())
         {
-            if (mContent[pos] == '/')
+            pos = findFirstOf<';', '\n', '/', '"'>(mContent, pos);
+
+            if (at(pos) == '/')
             {
                 skipComment();
             }
-            else if (mContent[pos] == '"')
+            else if (at(pos) == '"')
             {
                 skipStringLiteral();
             }
             else
             {
-                pos++;
+                break;
             }
         }
 
@@ -414,9 +464,9 @@ private:
 
     auto skipMultiLineComment() -> void
     {
-        while (!atEnd() && !(mContent[pos] == '/' && mContent[pos - 1] == '*'))
+        while (!atEnd() && !(at(pos) == '/' && at(pos - 1) == '*'))
         {
-            pos++;
+            pos = findFirstOf<'/'>(mContent, pos + 1);
         }
 
         pos++;
@@ -426,7 +476,7 @@ private:
     {
         while (!atEnd())
         {
-            const char c = mContent[pos];
+            const char c = at(pos);
 
             if (c == '/')
             {
@@ -444,25 +494,26 @@ private:
         }
     }
 
-    [[nodiscard]] static auto trim(const std::string &str) -> std::string
+    [[nodiscard]] static auto trim(std::string_view str) -> std::string_view
     {
-        size_t prefix = 0;
-        size_t suffix = str.size();
-
-        while (std::isspace(str[prefix]) && prefix < str.size())
+        while (!str.empty() && std::isspace(str.front()))
         {
-            prefix++;
+            str.remove_prefix(1);
         }
 
-        while (std::isspace(str[suffix - 1]) && 0 < suffix)
+        while (!str.empty() && std::isspace(str.back()))
         {
-            suffix--;
+            str.remove_suffix(1);
         }
 
-        return str.substr(prefix, suffix - prefix);
+        return str;
     }
 
     size_t pos = 0;
-    std::string mContent;
+    std::string_view mContent;
+    std::size_t mPreambleThreshold = 0;
+    std::size_t mDeclarations = 0;
+    bool mModuleUnit = false;
+    std::deque<std::string> mJoinedNames;
 };
 }
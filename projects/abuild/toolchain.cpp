@@ -24,5 +24,6 @@ export struct Toolchain
     std::unordered_set<std::string> archiverFlags;
     std::filesystem::path includePath;
     std::filesystem::path libPath;
+    std::vector<std::filesystem::path> systemIncludePaths;
 };
 }
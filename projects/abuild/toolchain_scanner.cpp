@@ -1,6 +1,7 @@
 #ifdef _MSC_VER
 export module abuild : toolchain_scanner;
 export import : build_cache;
+import acore;
 #endif
 
 namespace abuild
@@ -21,6 +22,7 @@ private:
     {
         if (std::filesystem::exists(toolchain.compiler))
         {
+            toolchain.systemIncludePaths = systemIncludePaths(toolchain);
             mBuildCache.addToolchain(std::move(toolchain));
         }
     }
@@ -167,7 +169,7 @@ private:
 
         addToolchain(Toolchain{
             .name = "gcc" + version,
-            .type = Toolchain::Type::Clang,
+            .type = Toolchain::Type::GCC,
             .compiler = path / "bin" / ("g++" + suffix),
             .linker = path / "bin" / "ld",
             .archiver = path / "bin" / "ar",
@@ -278,6 +280,73 @@ private:
         return (version.empty() ? "" : "-") + version;
     }
 
+    [[nodiscard]] static auto systemIncludePaths(const Toolchain &toolchain) -> std::vector<std::filesystem::path>
+    {
+        std::error_code error;
+
+        if (toolchain.type == Toolchain::Type::MSVC)
+        {
+            return {toolchain.includePath};
+        }
+
+        if ((std::filesystem::status(toolchain.compiler, error).permissions() & std::filesystem::perms::owner_exec) == std::filesystem::perms::none)
+        {
+            return {};
+        }
+
+        std::vector<std::string> arguments;
+
+        for (const std::string &flag : toolchain.compilerFlags)
+        {
+            std::istringstream stream{flag};
+            std::string part;
+
+            while (stream >> part)
+            {
+                if (part != "-c")
+                {
+                    arguments.push_back(part);
+                }
+            }
+        }
+
+        arguments.insert(arguments.end(), {"-E", "-v", NULL_DEVICE});
+        const acore::Process process{toolchain.compiler.string(), arguments};
+        std::istringstream output{process.output()};
+        std::vector<std::filesystem::path> paths;
+        bool searchList = false;
+
+        for (std::string line; std::getline(output, line);)
+        {
+            if (line.starts_with("#include <...> search starts here:"))
+            {
+                searchList = true;
+            }
+            else if (line.starts_with("End of search list."))
+            {
+                break;
+            }
+            else if (searchList && line.starts_with(' '))
+            {
+                line = line.substr(line.find_first_not_of(' '));
+
+                if (const std::size_t framework = line.find(" (framework directory)"); framework != std::string::npos)
+                {
+                    line.erase(framework);
+                }
+
+                paths.push_back(std::filesystem::path{line}.lexically_normal());
+            }
+        }
+
+        return paths;
+    }
+
     BuildCache &mBuildCache;
+#ifdef _WIN32
+    static constexpr char NULL_DEVICE[] = "NUL";
+#else
+    static constexpr char NULL_DEVICE[] = "/dev/null";
+#endif
 };
 }
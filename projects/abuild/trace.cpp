@@ -0,0 +1,208 @@
+#ifdef _MSC_VER
+export module abuild : trace;
+export import<astl.hpp>;
+import<rapidjson.hpp>;
+#endif
+
+namespace abuild
+{
+export struct TraceEvent
+{
+    std::string name;
+    const char *category = "";
+    std::chrono::microseconds start{0};
+    std::chrono::microseconds duration{0};
+    std::uint32_t thread = 0;
+};
+
+export class Trace
+{
+public:
+    Trace() :
+        mState{std::make_unique<State>()}
+    {
+    }
+
+    auto clear() -> void
+    {
+        std::scoped_lock lock{mState->mutex};
+
+        for (ThreadEvents &thread : mState->threads)
+        {
+            std::scoped_lock threadLock{thread.mutex};
+            thread.events.clear();
+        }
+    }
+
+    [[nodiscard]] auto enabled() const noexcept -> bool
+    {
+        return mState->enabled;
+    }
+
+    [[nodiscard]] auto events() const -> std::vector<TraceEvent>
+    {
+        std::vector<TraceEvent> events;
+        std::scoped_lock lock{mState->mutex};
+
+        for (ThreadEvents &thread : mState->threads)
+        {
+            std::scoped_lock threadLock{thread.mutex};
+            events.insert(events.end(), thread.events.begin(), thread.events.end());
+        }
+
+        std::sort(events.begin(), events.end(), [](const TraceEvent &left, const TraceEvent &right) {
+            return left.start != right.start ? left.start < right.start : left.thread < right.thread;
+        });
+
+        return events;
+    }
+
+    [[nodiscard]] auto json() const -> std::string
+    {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+
+        writer.StartObject();
+        writer.Key("traceEvents");
+        writer.StartArray();
+
+        for (const TraceEvent &event : events())
+        {
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(event.name);
+            writer.Key("cat");
+            writer.String(event.category);
+            writer.Key("ph");
+            writer.String("X");
+            writer.Key("ts");
+            writer.Int64(event.start.count());
+            writer.Key("dur");
+            writer.Int64(event.duration.count());
+            writer.Key("pid");
+            writer.Uint(1);
+            writer.Key("tid");
+            writer.Uint(event.thread);
+            writer.EndObject();
+        }
+
+        writer.EndArray();
+        writer.Key("displayTimeUnit");
+        writer.String("ms");
+        writer.EndObject();
+
+        return buffer.GetString();
+    }
+
+    auto record(const char *category, std::string name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) -> void
+    {
+        ThreadEvents &thread = threadEvents();
+        std::scoped_lock lock{thread.mutex};
+        thread.events.push_back(TraceEvent{.name = std::move(name),
+                                           .category = category,
+                                           .start = std::chrono::duration_cast<std::chrono::microseconds>(start - mState->start),
+                                           .duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start),
+                                           .thread = thread.thread});
+    }
+
+    auto save(const std::filesystem::path &path) const -> void
+    {
+        std::filesystem::create_directories(path.parent_path());
+        const std::string data = json();
+        std::ofstream file{path, std::ios::trunc};
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+        if (!file)
+        {
+            throw std::runtime_error{"Failed to write trace '" + path.string() + "'."};
+        }
+    }
+
+    auto setEnabled(bool enabled) noexcept -> void
+    {
+        mState->enabled = enabled;
+    }
+
+private:
+    struct ThreadEvents
+    {
+        std::uint32_t thread = 0;
+        std::mutex mutex;
+        std::vector<TraceEvent> events;
+    };
+
+    struct State
+    {
+        std::uint64_t id = nextId();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::atomic<bool> enabled = true;
+        std::mutex mutex;
+        std::deque<ThreadEvents> threads;
+    };
+
+    [[nodiscard]] static auto nextId() noexcept -> std::uint64_t
+    {
+        static std::atomic<std::uint64_t> id = 0;
+        return ++id;
+    }
+
+    [[nodiscard]] auto threadEvents() -> ThreadEvents &
+    {
+        thread_local std::unordered_map<std::uint64_t, ThreadEvents *> threads;
+        ThreadEvents *&thread = threads[mState->id];
+
+        if (!thread)
+        {
+            std::scoped_lock lock{mState->mutex};
+            thread = &mState->threads.emplace_back();
+            thread->thread = static_cast<std::uint32_t>(mState->threads.size());
+        }
+
+        return *thread;
+    }
+
+    std::unique_ptr<State> mState;
+};
+
+export class TraceSpan
+{
+public:
+    TraceSpan(Trace &trace, const char *category, std::string_view name) :
+        TraceSpan{trace, category, [name] { return std::string{name}; }}
+    {
+    }
+
+    template<typename NameFunction>
+    requires std::is_invocable_r_v<std::string, NameFunction>
+    TraceSpan(Trace &trace, const char *category, NameFunction &&name) :
+        mTrace{trace.enabled() ? &trace : nullptr},
+        mCategory{category}
+    {
+        if (mTrace)
+        {
+            mName = name();
+            mStart = std::chrono::steady_clock::now();
+        }
+    }
+
+    TraceSpan(const TraceSpan &other) = delete;
+    TraceSpan(TraceSpan &&other) = delete;
+
+    ~TraceSpan()
+    {
+        if (mTrace)
+        {
+            mTrace->record(mCategory, std::move(mName), mStart, std::chrono::steady_clock::now());
+        }
+    }
+
+    auto operator=(const TraceSpan &other) -> TraceSpan & = delete;
+    auto operator=(TraceSpan &&other) -> TraceSpan & = delete;
+
+private:
+    Trace *mTrace = nullptr;
+    const char *mCategory = "";
+    std::string mName;
+    std::chrono::steady_clock::time_point mStart;
+};
+}
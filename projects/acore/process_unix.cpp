@@ -87,7 +87,7 @@ public:
     AsyncReader(std::string *output, int readFileDescriptor) :
         mThread{[output, readFileDescriptor] {
 		constexpr size_t BUFFER_SIZE = 65536;
-		static char buffer[BUFFER_SIZE] = {};
+		char buffer[BUFFER_SIZE] = {};
 		ssize_t bytesRead = 0;
 
 		while ((bytesRead = read(readFileDescriptor, buffer, BUFFER_SIZE)) > 0)